@@ -15,10 +15,19 @@
   // if Kc is chosen well, the additional required power due to increased melting should be compensated.
   #define PID_ADD_EXTRUSION_RATE
   #ifdef PID_ADD_EXTRUSION_RATE
-    #define  DEFAULT_Kc (1) //heating power=Kc*(e_speed)
+    // heating power=Kc*(e_speed), PID output (0-PID_MAX) per mm^3/s, set by M301 C
+    // About 0.45J/mm^3 melts PLA, that is 2.9 for the 40W heater.
+    #define  DEFAULT_Kc (2.5)
+    // Add the Kc term to the hotend PID output. The extrusion speed is the filament volume per second
+    // of the moves in the planner queue, so the heater gets the extra power before the flow increases.
+    //#define PID_EXTRUSION_RATE_FEED_FORWARD
   #endif
 #endif
 
+// Run the hotend and bed PID in manage_heater() in 32 bit integers instead of floats, see heater_pid.h.
+// Follows the float controller within a fraction of the PWM step.
+//#define FIXED_POINT_PID
+
 
 //automatic temperature: The hot end target temperature is calculated by all the buffered lines of gcode.
 //The maximum buffered steps/sec of the extruder motor are called "se".
@@ -212,44 +221,39 @@
 *
 * By default...
 *
-*  - Use the slowest -but safest- method for sorting.
 *  - Folders are sorted to the top.
-*  - The sort key is statically allocated.
 *  - No added G-code (M34) support.
-*  - 40 item sorting limit. (Items after the first 40 are unsorted.)
-*
-* SD sorting uses static allocation (as set by SDSORT_LIMIT), allowing the
-* compiler to calculate the worst-case usage and throw an error if the SRAM
-* limit is exceeded.
+*  - 100 item sorting limit. (Items after the first 100 are unsorted.)
 *
-*  - SDSORT_USES_RAM provides faster sorting via a static directory buffer.
-*  - SDSORT_USES_STACK does the same, but uses a local stack-based buffer.
-*  - SDSORT_CACHE_NAMES will retain the sorted file listing in RAM. (Expensive!)
-*  - SDSORT_DYNAMIC_RAM only uses RAM when the SD menu is visible. (Use with caution!)
+* The sort order is stored on the card in SORTIDX.BIN in the root folder, one slot
+* for each of the last SDSORT_INDEX_SLOTS visited folders. A folder is sorted again
+* only after its content has changed, and then only the new files are sorted in.
+* While sorting, the order takes 2 bytes of stack for each item. If the index cannot be
+* written, e.g. on a write protected card, the order is kept in RAM, 1 byte for each item.
 */
 	#define SDCARD_SORT_ALPHA //Alphabetical sorting of SD files menu
 	
 	// SD Card Sorting options
-	// In current firmware Prusa Firmware version,
-	// SDSORT_CACHE_NAMES and SDSORT_DYNAMIC_RAM is not supported and must be set to 0.
 	#ifdef SDCARD_SORT_ALPHA
 	  #define SD_SORT_TIME 0
 	  #define SD_SORT_ALPHA 1
 	  #define SD_SORT_NONE 2
 	
-	  #define SDSORT_LIMIT       100    // Maximum number of sorted items (10-256).
+	  #define SDSORT_LIMIT       100    // Maximum number of sorted items.
+	  #define SDSORT_INDEX_SLOTS 8      // Number of folders with the sort order kept in the index on the card.
 	  #define FOLDER_SORTING     -1     // -1=above  0=none  1=below
 	  #define SDSORT_GCODE       0  // Allow turning sorting on/off with LCD and M34 g-code.
-	  #define SDSORT_USES_RAM    0  // Pre-allocate a static array for faster pre-sorting.
-	  #define SDSORT_USES_STACK  0  // Prefer the stack for pre-sorting to give back some SRAM. (Negated by next 2 options.)
-	  #define SDSORT_CACHE_NAMES 0  // Keep sorted items in RAM longer for speedy performance. Most expensive option.
-	  #define SDSORT_DYNAMIC_RAM 0  // Use dynamic allocation (within SD menus). Least expensive option. Set SDSORT_LIMIT before use!
 	#endif
 	
 	#if defined(SDCARD_SORT_ALPHA)
 	  #define HAS_FOLDER_SORTING (FOLDER_SORTING || SDSORT_GCODE)
 	#endif
 
+	// Bytes of RAM for the decoded names of the recently shown SD menu items, so that scrolling
+	// does not read the card for every redraw. An item takes 70 bytes, plus 2 bytes for the item
+	// count, e.g. 210 for the 3 file rows of the menu. 0 disables the cache.
+	#define SDCARD_NAME_CACHE_BYTES 0
+
 // Enable the option to stop SD printing when hitting and endstops, needs to be enabled from the LCD menu when this option is enabled.
 //#define ABORT_ON_ENDSTOP_HIT_FEATURE_ENABLED
 
@@ -308,7 +312,13 @@
 #endif
 
 // Arc interpretation settings:
+// The chord length of the arc segments is chosen so the chord deviates from the arc by at most ARC_TOLERANCE,
+// but the segments are made longer at high feedrates, so that at most ARC_SEGMENTS_PER_SEC are fed to the planner.
+// The result is limited to <MIN_MM_PER_ARC_SEGMENT, MM_PER_ARC_SEGMENT>.
 #define MM_PER_ARC_SEGMENT 1
+#define MIN_MM_PER_ARC_SEGMENT 0.1
+#define ARC_TOLERANCE 0.005 // mm
+#define ARC_SEGMENTS_PER_SEC 200
 #define N_ARC_CORRECTION 25
 
 const unsigned int dropsegments=5; //everything with less than this number of steps will be ignored as move and joined with the next movement
@@ -345,11 +355,15 @@ const unsigned int dropsegments=5; //everything with less than this number of st
 
 // The number of linear motions that can be in the plan at any give time.
 // THE BLOCK_BUFFER_SIZE NEEDS TO BE A POWER OF 2, i.g. 8,16,32 because shifts and ors are used to do the ring-buffering.
+// The depth may be overridden from the build (-DBLOCK_BUFFER_SIZE=32) to trade RAM for a longer look-ahead,
+// the planner occupancy telemetry (M721, PLANNER_DIAGNOSTICS) tells whether the queue runs dry.
+#ifndef BLOCK_BUFFER_SIZE
 #if defined SDSUPPORT
   #define BLOCK_BUFFER_SIZE 16   // SD,LCD,Buttons take more memory, block buffer needs to be smaller
 #else
   #define BLOCK_BUFFER_SIZE 16 // maximize block buffer
 #endif
+#endif
 
 
 //The ASCII buffer for receiving from the serial:
@@ -360,6 +374,14 @@ const unsigned int dropsegments=5; //everything with less than this number of st
 // 2nd and 3rd byte (LSB first) contains a 16bit length of a command including its preceding comments.
 #define CMDHDRSIZE 3
 
+// Accept the motion and temperature commands as compact binary packets on the serial line, enabled by M720 S1.
+// See binary_gcode.h for the framing. Each queued packet takes sizeof(binary_gcode_packet_t) bytes of RAM.
+//#define BINARY_GCODE
+#define BINARY_GCODE_QUEUE_SIZE 8
+// Parse the plain G0 / G1 moves while they are enqueued and keep them in the queue of the binary commands,
+// so that their execution skips the text parser. Requires BINARY_GCODE.
+//#define GCODE_FAST_PATH
+
 
 // Firmware based and LCD controlled retract
 // M207 and M208 can be used to define parameters for the retraction.
@@ -152,6 +152,7 @@ void dcode_3()
 #include "temperature.h"
 #include <avr/wdt.h>
 #include "bootapp.h"
+#include "planner.h"
 
 #if 0
 #define FLASHSIZE     0x40000
@@ -678,3 +679,30 @@ void dcode_9125()
 
 
 #endif //DEBUG_DCODES
+
+#ifdef PLANNER_DIAGNOSTICS
+void dcode_40()
+{
+	printf_P(PSTR("D40 - Planner telemetry\n"));
+	planner_stats_t stats;
+	CRITICAL_SECTION_START;
+	stats = planner_stats;
+	uint16_t empty_ms = planner_queue_empty_ms;
+	uint8_t head = block_buffer_head;
+	uint8_t tail = block_buffer_tail;
+	CRITICAL_SECTION_END;
+	printf_P(PSTR("size=%d queued=%d head=%d tail=%d empty_ms=%u\n"), BLOCK_BUFFER_SIZE, (head + BLOCK_BUFFER_SIZE - tail) & (BLOCK_BUFFER_SIZE - 1), head, tail, empty_ms);
+	printf_P(PSTR("min=%d sum=%lu samples=%u underruns=%u starved_ms=%lu\n"), stats.queue_min, stats.queue_sum, stats.samples, stats.underruns, stats.starved_ms);
+	if (code_seen('B')) // dump the queued blocks
+	{
+		for (uint8_t i = tail; i != head; i = (i + 1) & (BLOCK_BUFFER_SIZE - 1))
+		{
+			block_t *block = &block_buffer[i];
+			printf_P(PSTR("\t%d: events=%lu entry=%d nominal=%d max_entry=%d flag=%x\n"), i, block->step_event_count.wide,
+				(int)block->entry_speed, (int)block->nominal_speed, (int)block->max_entry_speed, block->flag);
+		}
+	}
+	if (code_seen('R')) // reset the statistics
+		planner_stats_reset();
+}
+#endif //PLANNER_DIAGNOSTICS
@@ -16,6 +16,10 @@ extern void dcode_9(); //D9 - Read/Write ADC (Write=enable simulated, Read=disab
 
 extern void dcode_10(); //D10 - XYZ calibration = OK
 
+#ifdef PLANNER_DIAGNOSTICS
+extern void dcode_40(); //D40 - Planner telemetry
+#endif //PLANNER_DIAGNOSTICS
+
 #ifdef TMC2130
 extern void dcode_2130(); //D2130 - TMC2130
 #endif //TMC2130
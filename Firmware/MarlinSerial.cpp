@@ -31,23 +31,9 @@ uint8_t selectedSerialPort = 0;
 #if defined(UBRRH) || defined(UBRR0H) || defined(UBRR1H) || defined(UBRR2H) || defined(UBRR3H)
 
 #if UART_PRESENT(SERIAL_PORT)
-  ring_buffer rx_buffer  =  { { 0 }, 0, 0 };
+  ring_buffer rx_buffer  =  { { 0 }, 0, 0, 0, 0 };
 #endif
 
-FORCE_INLINE void store_char(unsigned char c)
-{
-  int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
-
-  // if we should be storing the received character into the location
-  // just before the tail (meaning that the head would advance to the
-  // current location of the tail), we're about to overflow the buffer
-  // and so we don't write the character or advance the head.
-  if (i != rx_buffer.tail) {
-    rx_buffer.buffer[rx_buffer.head] = c;
-    rx_buffer.head = i;
-  }
-}
-
 
 #if defined(M_USARTx_RX_vect)
 // The serial line receive interrupt routine for a baud rate 115200
@@ -66,10 +52,13 @@ ISR(M_USARTx_RX_vect)
 	}
 	else
 	{
+		// A character was lost in the UART before this one.
+		if ((M_UCSRxA & (1<<M_DORx)) && rx_buffer.overrun != 0xffff)
+			++ rx_buffer.overrun;
 		// Read the input register.
 		unsigned char c = M_UDRx;
 		if (selectedSerialPort == 0)
-			store_char(c);
+			rx_buffer_store(c);
 #ifdef DEBUG_DUMP_TO_2ND_SERIAL
 		UDR1 = c;
 #endif //DEBUG_DUMP_TO_2ND_SERIAL
@@ -87,10 +76,13 @@ ISR(USART1_RX_vect)
 	}
 	else
 	{
+		// A character was lost in the UART before this one.
+		if ((UCSR1A & (1<<DOR1)) && rx_buffer.overrun != 0xffff)
+			++ rx_buffer.overrun;
 		// Read the input register.
 		unsigned char c = UDR1;
 		if (selectedSerialPort == 1)
-			store_char(c);
+			rx_buffer_store(c);
 #ifdef DEBUG_DUMP_TO_2ND_SERIAL
 		M_UDRx = c;
 #endif //DEBUG_DUMP_TO_2ND_SERIAL
@@ -170,33 +162,32 @@ void MarlinSerial::end()
 
 int MarlinSerial::peek(void)
 {
-  if (rx_buffer.head == rx_buffer.tail) {
+  uint8_t tail = rx_buffer.tail;
+  if (rx_buffer.head == tail) {
     return -1;
   } else {
-    return rx_buffer.buffer[rx_buffer.tail];
+    return rx_buffer.buffer[tail];
   }
 }
 
 int MarlinSerial::read(void)
 {
+  uint8_t tail = rx_buffer.tail;
   // if the head isn't ahead of the tail, we don't have any characters
-  if (rx_buffer.head == rx_buffer.tail) {
+  if (rx_buffer.head == tail) {
     return -1;
   } else {
-    unsigned char c = rx_buffer.buffer[rx_buffer.tail];
-    rx_buffer.tail = (unsigned int)(rx_buffer.tail + 1) % RX_BUFFER_SIZE;
+    unsigned char c = rx_buffer.buffer[tail];
+    rx_buffer.tail = (tail + 1) & RX_BUFFER_MASK;
     return c;
   }
 }
 
 void MarlinSerial::flush()
 {
-  // don't reverse this or there may be problems if the RX interrupt
-  // occurs after reading the value of rx_buffer_head but before writing
-  // the value to rx_buffer_tail; the previous value of rx_buffer_head
-  // may be written to rx_buffer_tail, making it appear as if the buffer
-  // were full, not empty.
-  rx_buffer.head = rx_buffer.tail;
+  // Discard the received characters by advancing the tail, the head belongs to the RX interrupt.
+  // A character received meanwhile is discarded or kept, either way the ring stays consistent.
+  rx_buffer.tail = rx_buffer.head;
 }
 
 
@@ -54,6 +54,7 @@
 #define M_UBRRxL SERIAL_REGNAME(UBRR,SERIAL_PORT,L)
 #define M_RXCx SERIAL_REGNAME(RXC,SERIAL_PORT,)
 #define M_FEx SERIAL_REGNAME(FE,SERIAL_PORT,)
+#define M_DORx SERIAL_REGNAME(DOR,SERIAL_PORT,)
 #define M_USARTx_RX_vect SERIAL_REGNAME(USART,SERIAL_PORT,_RX_vect)
 #define M_U2Xx SERIAL_REGNAME(U2X,SERIAL_PORT,)
 
@@ -68,22 +69,52 @@
 
 #ifndef AT90USB
 // Define constants and variables for buffering incoming serial data.  We're
-// using a ring buffer (I think), in which rx_buffer_head is the index of the
-// location to which to write the next incoming character and rx_buffer_tail
+// using a ring buffer, in which rx_buffer.head is the index of the
+// location to which to write the next incoming character and rx_buffer.tail
 // is the index of the location from which to read.
-#define RX_BUFFER_SIZE 128
+// The size is a power of two up to 256, so the 8-bit indices wrap by masking.
+// 256 bytes hold 22ms of data at 115200 baud, while the main loop is busy elsewhere.
+#ifndef RX_BUFFER_SIZE
+#define RX_BUFFER_SIZE 256
+#endif
+#define RX_BUFFER_MASK (RX_BUFFER_SIZE - 1)
+static_assert(RX_BUFFER_SIZE >= 2 && RX_BUFFER_SIZE <= 256 && (RX_BUFFER_SIZE & RX_BUFFER_MASK) == 0,
+  "RX_BUFFER_SIZE shall be a power of two not larger than 256.");
 
 extern uint8_t selectedSerialPort;
 
+// Single producer / single consumer ring: the head is only written by the RX interrupt,
+// the tail is only written by the main loop. The indices are single bytes,
+// which are read and written atomically, so no locking is needed.
 struct ring_buffer
 {
   unsigned char buffer[RX_BUFFER_SIZE];
-  int head;
-  int tail;
+  volatile uint8_t head;
+  volatile uint8_t tail;
+  // Number of characters dropped, because the ring was full.
+  volatile uint16_t overflow;
+  // Number of characters lost by the UART, because the RX interrupt was not serviced in time (data overrun).
+  volatile uint16_t overrun;
 };
 
 #if UART_PRESENT(SERIAL_PORT)
   extern ring_buffer rx_buffer;
+
+// Called by the RX interrupts and by MarlinSerial::checkRx() only.
+FORCE_INLINE void rx_buffer_store(unsigned char c)
+{
+  uint8_t head = rx_buffer.head;
+  uint8_t i = (head + 1) & RX_BUFFER_MASK;
+  // if we should be storing the received character into the location
+  // just before the tail (meaning that the head would advance to the
+  // current location of the tail), we're about to overflow the buffer
+  // and so we don't write the character or advance the head.
+  if (i != rx_buffer.tail) {
+    rx_buffer.buffer[head] = c;
+    rx_buffer.head = i;
+  } else if (rx_buffer.overflow != 0xffff)
+    ++ rx_buffer.overflow;
+}
 #endif
 
 class MarlinSerial //: public Stream
@@ -98,7 +129,7 @@ class MarlinSerial //: public Stream
     
     static /*FORCE_INLINE*/ int available(void)
     {
-      return (unsigned int)(RX_BUFFER_SIZE + rx_buffer.head - rx_buffer.tail) % RX_BUFFER_SIZE;
+      return (uint8_t)(rx_buffer.head - rx_buffer.tail) & RX_BUFFER_MASK;
     }
     /*
     FORCE_INLINE void write(uint8_t c)
@@ -134,15 +165,7 @@ class MarlinSerial //: public Stream
                     (void)(*(char *)M_UDRx);
                 } else {
                     unsigned char c  =  M_UDRx;
-                    int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
-                    // if we should be storing the received character into the location
-                    // just before the tail (meaning that the head would advance to the
-                    // current location of the tail), we're about to overflow the buffer
-                    // and so we don't write the character or advance the head.
-                    if (i != rx_buffer.tail) {
-                        rx_buffer.buffer[rx_buffer.head] = c;
-                        rx_buffer.head = i;
-                    }
+                    rx_buffer_store(c);
                     //selectedSerialPort = 0;
 #ifdef DEBUG_DUMP_TO_2ND_SERIAL
 					UDR1 = c;
@@ -158,15 +181,7 @@ class MarlinSerial //: public Stream
                     (void)(*(char *)UDR1);
                 } else {
                     unsigned char c  =  UDR1;
-                    int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
-                    // if we should be storing the received character into the location
-                    // just before the tail (meaning that the head would advance to the
-                    // current location of the tail), we're about to overflow the buffer
-                    // and so we don't write the character or advance the head.
-                    if (i != rx_buffer.tail) {
-                        rx_buffer.buffer[rx_buffer.head] = c;
-                        rx_buffer.head = i;
-                    }
+                    rx_buffer_store(c);
                     //selectedSerialPort = 1;
 #ifdef DEBUG_DUMP_TO_2ND_SERIAL
 					M_UDRx = c;
@@ -395,6 +395,9 @@ static void wait_for_heater(long codenum, uint8_t extruder);
 static void gcode_G28(bool home_x_axis, bool home_y_axis, bool home_z_axis);
 static void temp_compensation_start();
 static void temp_compensation_apply();
+#ifdef BINARY_GCODE
+static void process_binary_command(const binary_gcode_packet_t &packet);
+#endif /* BINARY_GCODE */
 
 
 uint16_t gcode_in_progress = 0;
@@ -1831,7 +1834,7 @@ void loop()
           sei();
         }
 	  }
-	  else if((*ptr == CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR) && !IS_SD_PRINTING){ 
+	  else if((*ptr == CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR || *ptr == CMDBUFFER_CURRENT_TYPE_BINARY) && !IS_SD_PRINTING){ 
 		  
 		  cli();
           *ptr ++ = CMDBUFFER_CURRENT_TYPE_TO_BE_REMOVED;
@@ -3454,7 +3457,7 @@ extern uint8_t st_backlash_y;
 //!@n M250 - Set LCD contrast C<contrast value> (value 0..63)
 //!@n M280 - set servo position absolute. P: servo index, S: angle or microseconds
 //!@n M300 - Play beep sound S<frequency Hz> P<duration ms>
-//!@n M301 - Set PID parameters P I and D
+//!@n M301 - Set PID parameters P I and D, C the extrusion rate feed-forward
 //!@n M302 - Allow cold extrudes, or set the minimum extrude S<temperature>.
 //!@n M303 - PID relay autotune S<temperature> sets the target temperature. (default target temperature = 150C)
 //!@n M304 - Set bed PID parameters P I and D
@@ -3473,6 +3476,9 @@ extern uint8_t st_backlash_y;
 //!@n M540 - Use S[0|1] to enable or disable the stop SD card print on endstop hit (requires ABORT_ON_ENDSTOP_HIT_FEATURE_ENABLED)
 //!@n M600 - Pause for filament change X[pos] Y[pos] Z[relative lift] E[initial retract] L[later retract distance for removal]
 //!@n M605 - Set dual x-carriage movement mode: S<mode> [ X<duplication x-offset> R<duplication temp offset> ]
+//!@n M720 - Enable or disable the binary command packets on the serial line S[0|1] and report their state
+//!@n M721 - Report the planner queue occupancy and serial RX telemetry, R resets it (requires PLANNER_DIAGNOSTICS)
+//!@n M722 - Windowed flow control S[0|1], the ok reports the line number and the free queue space
 //!@n M860 - Wait for PINDA thermistor to reach target temperature.
 //!@n M861 - Set / Read PINDA temperature compensation offsets
 //!@n M900 - Set LIN_ADVANCE options, if enabled. See Configuration_adv.h for details.
@@ -3518,6 +3524,20 @@ void process_commands()
   SERIAL_ECHO(buflen);
   SERIAL_ECHOLNPGM("");
 #endif /* CMDBUFFER_DEBUG */
+
+#ifdef BINARY_GCODE
+  {
+    // Binary packets and the moves already parsed by GCODE_FAST_PATH.
+    binary_gcode_packet_t packet;
+    if (cmdqueue_binary_take(packet)) {
+      KEEPALIVE_STATE(IN_HANDLER);
+      process_binary_command(packet);
+      KEEPALIVE_STATE(NOT_BUSY);
+      ClearToSend();
+      return;
+    }
+  }
+#endif /* BINARY_GCODE */
   
   unsigned long codenum; //throw away variable
   char *starpos = NULL;
@@ -3863,7 +3883,7 @@ eeprom_update_word((uint16_t*)EEPROM_NOZZLE_DIAMETER_uM,0xFFFF);
   // }
   else if(code_seen('G'))
   {
-	gcode_in_progress = (int)code_value();
+	gcode_in_progress = code_value_short();
 //	printf_P(_N("BEGIN G-CODE=%u\n"), gcode_in_progress);
     switch (gcode_in_progress)
     {
@@ -5046,6 +5066,7 @@ if(eSoundMode!=e_SOUND_MODE_SILENT)
                 }
 */
 //		SERIAL_ECHOLNPGM("Upsample finished");
+		mbl.invalidate_cell(); //z_values were modified directly by the bed leveling correction and the interpolation
 		mbl.active = 1; //activate mesh bed leveling
 //		SERIAL_ECHOLNPGM("Mesh bed leveling activated");
 		go_home_with_z_lift();
@@ -5264,7 +5285,7 @@ if(eSoundMode!=e_SOUND_MODE_SILENT)
 
 	  } else
 	  {
-	  mcode_in_progress = (int)code_value();
+	  mcode_in_progress = code_value_short();
 //	printf_P(_N("BEGIN M-CODE=%u\n"), mcode_in_progress);
 
     switch(mcode_in_progress)
@@ -6125,6 +6146,9 @@ Sigma_Exit:
         target_direction = isHeatingBed(); // true if heating, false if cooling
 
 		KEEPALIVE_STATE(NOT_BUSY);
+#ifdef PLANNER_DIAGNOSTICS
+        planner_stats_expect_drain();
+#endif /* PLANNER_DIAGNOSTICS */
         while ( (target_direction)&&(!cancel_heatup) ? (isHeatingBed()) : (isCoolingBed()&&(CooldownNoWait==false)) )
         {
           if(( _millis() - codenum) > 1000 ) //Print Temp Reading every 1 second while heating up.
@@ -7748,6 +7772,80 @@ Sigma_Exit:
 	}
 	break;
 
+#ifdef BINARY_GCODE
+    //! ### M720 - Binary command framing
+    // -----------------------------------
+    /*!
+    Accept the G1 moves and the M104 / M140 temperatures as compact binary packets with a CRC
+    (see binary_gcode.h) in addition to the text G-code lines. The packets are numbered and
+    acknowledged like the text lines, which keep working in the binary mode. Send the packets only
+    after the `ok` of `M720 S1`.
+
+          M720 [S]
+
+    - `S1` - Enable the binary packets
+    - `S0` - Disable the binary packets
+    The state, the protocol version and the number of packets the firmware queues are reported in any case.
+    */
+    case 720:
+      if (code_seen('S'))
+        binary_gcode_enabled = code_value_uint8() != 0;
+      printf_P(_N("Binary G-code:%d version:%d queue:%d\n"), binary_gcode_enabled, BINARY_GCODE_VERSION, BINARY_GCODE_QUEUE_SIZE);
+      break;
+#endif /* BINARY_GCODE */
+
+#ifdef PLANNER_DIAGNOSTICS
+    //! ### M721 - Planner queue telemetry
+    // -----------------------------------
+    /*!
+    Report the planner queue occupancy since the last reset: minimum and average number of queued blocks
+    seen by a new block, the number of underruns (the stepper ran out of blocks while the motion was expected
+    to continue) and the time the stepper starved in them. Use it to tell whether the USB host or the SD card
+    feeds the planner fast enough. The serial line characters dropped by a full RX buffer (overflow) and lost
+    by the UART (overrun) are reported on the second line.
+
+          M721 [R]
+
+    - `R` - Reset the telemetry after reporting it
+    */
+    case 721:
+    {
+      const uint16_t samples = planner_stats.samples;
+      const uint16_t avg10 = samples ? (uint16_t)((planner_stats.queue_sum * 10 + samples / 2) / samples) : 0;
+      printf_P(_N("Planner min:%d avg:%d.%d underruns:%u starved:%lums size:%d\n"),
+        samples ? planner_stats.queue_min : 0, avg10 / 10, avg10 % 10,
+        planner_stats.underruns, planner_stats.starved_ms, BLOCK_BUFFER_SIZE);
+      printf_P(_N("Serial overflow:%u overrun:%u size:%d\n"), rx_buffer.overflow, rx_buffer.overrun, RX_BUFFER_SIZE);
+      if (code_seen('R')) {
+        planner_stats_reset();
+        CRITICAL_SECTION_START;
+        rx_buffer.overflow = 0;
+        rx_buffer.overrun = 0;
+        CRITICAL_SECTION_END;
+      }
+    }
+    break;
+#endif /* PLANNER_DIAGNOSTICS */
+
+    //! ### M722 - Windowed flow control
+    // ---------------------------------
+    /*!
+    Acknowledge the serial lines with `ok N<line> P<planner> B<queue>` instead of a plain `ok`: the line number
+    of the executed command (if it was numbered), the number of free planner blocks and the number of commands
+    of the maximum length, which still fit into the command queue. The host may keep up to B lines in flight
+    instead of waiting for the ok of each line. The ok of a resend request reports the last accepted line.
+    The lines in flight after a resend request are dropped silently until the requested line arrives.
+
+          M722 [S]
+
+    - `S1` - Enable the windowed flow control
+    - `S0` - One plain ok per line (default)
+    */
+    case 722:
+      if (code_seen('S'))
+        cmdqueue_windowed_ok = code_value_uint8() != 0;
+      break;
+
     //! ### M999 - Restart after being stopped
     // ------------------------------------
     case 999:
@@ -7965,7 +8063,7 @@ Sigma_Exit:
 
   else if (code_seen('D')) // D codes (debug)
   {
-    switch((int)code_value())
+    switch(code_value_short())
     {
 
   //! ### D-1 - Endless loop
@@ -8173,6 +8271,20 @@ Sigma_Exit:
 #endif //FILAMENT_SENSOR
 
 #endif //DEBUG_DCODES
+
+#ifdef PLANNER_DIAGNOSTICS
+  //! ### D40 - Planner telemetry
+  // ---------------------------
+  /*!
+      D40 [B R]
+
+    Print the raw planner queue telemetry counters and the ring buffer indices.
+    - `B` - Dump the queued blocks
+    - `R` - Reset the telemetry
+  */
+	case 40:
+		dcode_40(); break;
+#endif //PLANNER_DIAGNOSTICS
 	}
   }
 
@@ -8194,11 +8306,26 @@ Sigma_Exit:
 
 // ---------------------------------------------------
 
+// The ok of the windowed flow control (M722): the line number of the acknowledged command if it was numbered,
+// the free planner blocks and the free command queue slots.
+static void windowed_ok(long line)
+{
+  if (line >= 0)
+    printf_P(_N("ok N%ld P%d B%d\n"), line, BLOCK_BUFFER_SIZE - 1 - moves_planned(), cmdqueue_free_slots());
+  else
+    printf_P(_N("ok P%d B%d\n"), BLOCK_BUFFER_SIZE - 1 - moves_planned(), cmdqueue_free_slots());
+}
+
 void FlushSerialRequestResend()
 {
   //char cmdbuffer[bufindr][100]="Resend:";
   MYSERIAL.flush();
-  printf_P(_N("%S: %ld\n%S\n"), _n("Resend"), gcode_LastN + 1, MSG_OK);
+  cmdqueue_resend_requested = true;
+  if (cmdqueue_windowed_ok) {
+    printf_P(_N("%S: %ld\n"), _n("Resend"), gcode_LastN + 1);
+    windowed_ok(gcode_LastN);
+  } else
+    printf_P(_N("%S: %ld\n%S\n"), _n("Resend"), gcode_LastN + 1, MSG_OK);
 }
 
 // Confirm the execution of a command, if sent from a serial line.
@@ -8206,8 +8333,12 @@ void FlushSerialRequestResend()
 void ClearToSend()
 {
     previous_millis_cmd = _millis();
-	if ((CMDBUFFER_CURRENT_TYPE == CMDBUFFER_CURRENT_TYPE_USB) || (CMDBUFFER_CURRENT_TYPE == CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR)) 
-		SERIAL_PROTOCOLLNRPGM(MSG_OK);
+	if ((CMDBUFFER_CURRENT_TYPE == CMDBUFFER_CURRENT_TYPE_USB) || (CMDBUFFER_CURRENT_TYPE == CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR) || (CMDBUFFER_CURRENT_TYPE == CMDBUFFER_CURRENT_TYPE_BINARY)) {
+		if (cmdqueue_windowed_ok)
+			windowed_ok(cmdqueue_current_line());
+		else
+			SERIAL_PROTOCOLLNRPGM(MSG_OK);
+	}
 }
 
 #if MOTHERBOARD == BOARD_RAMBO_MINI_1_0 || MOTHERBOARD == BOARD_RAMBO_MINI_1_3
@@ -8249,47 +8380,90 @@ void update_currents() {
 }
 #endif //MOTHERBOARD == BOARD_RAMBO_MINI_1_0 || MOTHERBOARD == BOARD_RAMBO_MINI_1_3
 
-void get_coordinates()
+//! Set destination[i] from a coordinate of a move, honoring the relative modes and the extrusion multiplier.
+static void set_destination_coordinate(uint8_t i, float value)
 {
-  bool seen[4]={false,false,false,false};
-  for(int8_t i=0; i < NUM_AXIS; i++) {
-    if(code_seen(axis_codes[i]))
-    {
-      bool relative = axis_relative_modes[i] || relative_mode;
-      destination[i] = (float)code_value();
-      if (i == E_AXIS) {
-        float emult = extruder_multiplier[active_extruder];
-        if (emult != 1.) {
-          if (! relative) {
-            destination[i] -= current_position[i];
-            relative = true;
-          }
-          destination[i] *= emult;
-        }
+  bool relative = axis_relative_modes[i] || relative_mode;
+  destination[i] = value;
+  if (i == E_AXIS) {
+    float emult = extruder_multiplier[active_extruder];
+    if (emult != 1.) {
+      if (! relative) {
+        destination[i] -= current_position[i];
+        relative = true;
       }
-      if (relative)
-        destination[i] += current_position[i];
-      seen[i]=true;
-#if MOTHERBOARD == BOARD_RAMBO_MINI_1_0 || MOTHERBOARD == BOARD_RAMBO_MINI_1_3
-	  if (i == Z_AXIS && SilentModeMenu == SILENT_MODE_AUTO) update_currents();
-#endif //MOTHERBOARD == BOARD_RAMBO_MINI_1_0 || MOTHERBOARD == BOARD_RAMBO_MINI_1_3
+      destination[i] *= emult;
     }
-    else destination[i] = current_position[i]; //Are these else lines really needed?
   }
-  if(code_seen('F')) {
-    next_feedrate = code_value();
+  if (relative)
+    destination[i] += current_position[i];
+#if MOTHERBOARD == BOARD_RAMBO_MINI_1_0 || MOTHERBOARD == BOARD_RAMBO_MINI_1_3
+  if (i == Z_AXIS && SilentModeMenu == SILENT_MODE_AUTO) update_currents();
+#endif //MOTHERBOARD == BOARD_RAMBO_MINI_1_0 || MOTHERBOARD == BOARD_RAMBO_MINI_1_3
+}
+
+//! Set the feedrate of a move [mm/min], limited in the silent mode.
+static void set_move_feedrate(float value)
+{
+  next_feedrate = value;
 #ifdef MAX_SILENT_FEEDRATE
-	if (tmc2130_mode == TMC2130_MODE_SILENT)
-		if (next_feedrate > MAX_SILENT_FEEDRATE) next_feedrate = MAX_SILENT_FEEDRATE;
+  if (tmc2130_mode == TMC2130_MODE_SILENT)
+    if (next_feedrate > MAX_SILENT_FEEDRATE) next_feedrate = MAX_SILENT_FEEDRATE;
 #endif //MAX_SILENT_FEEDRATE
-    if(next_feedrate > 0.0) feedrate = next_feedrate;
-	if (!seen[0] && !seen[1] && !seen[2] && seen[3])
-	{
-//		float e_max_speed = 
-//		printf_P(PSTR("E MOVE speed %7.3f\n"), feedrate / 60)
-	}
+  if(next_feedrate > 0.0) feedrate = next_feedrate;
+}
+
+void get_coordinates()
+{
+  for(int8_t i=0; i < NUM_AXIS; i++) {
+    if(code_seen(axis_codes[i]))
+      set_destination_coordinate(i, (float)code_value());
+    else destination[i] = current_position[i]; //Are these else lines really needed?
+  }
+  if(code_seen('F'))
+    set_move_feedrate(code_value());
+}
+
+#ifdef BINARY_GCODE
+//! @brief Execute a command received as a binary packet (M720) or a move parsed while enqueued (GCODE_FAST_PATH).
+//!
+//! The values arrive decoded, the G-code text parser is skipped. A move packet behaves as G1,
+//! a temperature packet as M104 S or M140 S.
+static void process_binary_command(const binary_gcode_packet_t &packet)
+{
+  if (packet.type == BINARY_GCODE_TEMPERATURE) {
+    if (packet.mask == BINARY_GCODE_BED)
+      setTargetBed(packet.value[0]);
+    else
+      setTargetHotendSafe(packet.value[0], active_extruder);
+    return;
+  }
+  if (Stopped)
+    return;
+  for (uint8_t i = 0; i < NUM_AXIS; ++ i) {
+    if (packet.mask & (1 << i))
+      set_destination_coordinate(i, packet.value[i]);
+    else
+      destination[i] = current_position[i];
+  }
+  if (packet.mask & BINARY_GCODE_F)
+    set_move_feedrate(packet.value[BINARY_GCODE_F_INDEX]);
+  if (total_filament_used > ((current_position[E_AXIS] - destination[E_AXIS]) * 100)) //protection against total_filament_used overflow
+    total_filament_used = total_filament_used + ((destination[E_AXIS] - current_position[E_AXIS]) * 100);
+#ifdef FWRETRACT
+  if (cs.autoretract_enabled && (packet.mask & (BINARY_GCODE_X | BINARY_GCODE_Y | BINARY_GCODE_Z | BINARY_GCODE_E)) == BINARY_GCODE_E) {
+    float echange = destination[E_AXIS] - current_position[E_AXIS];
+    if ((echange < -MIN_RETRACT && !retracted[active_extruder]) || (echange > MIN_RETRACT && retracted[active_extruder])) { //move appears to be an attempt to retract or recover
+      current_position[E_AXIS] = destination[E_AXIS];
+      plan_set_e_position(current_position[E_AXIS]);
+      retract(!retracted[active_extruder]);
+      return;
+    }
   }
+#endif //FWRETRACT
+  prepare_move();
 }
+#endif /* BINARY_GCODE */
 
 void get_arc_coordinates()
 {
@@ -8342,19 +8516,18 @@ void clamp_to_software_endstops(float target[3])
         float dx = x - current_position[X_AXIS];
         float dy = y - current_position[Y_AXIS];
         float dz = z - current_position[Z_AXIS];
-        int n_segments = 0;
+        uint8_t n_crossings = 0;
+        float t_crossings[mesh_bed_leveling::max_crossings];
 		
-        if (mbl.active) {
-            float len = abs(dx) + abs(dy);
-            if (len > 0)
-                // Split to 3cm segments or shorter.
-                n_segments = int(ceil(len / 30.f));
-        }
+        if (mbl.active)
+            // Split at the mesh cell boundaries, so that the bends of the bed at the mesh lines are followed.
+            // All the split points are calculated before the first segment is planned.
+            n_crossings = mesh_bed_leveling::get_crossings(current_position[X_AXIS], current_position[Y_AXIS], dx, dy, t_crossings);
         
-        if (n_segments > 1) {
+        if (n_crossings > 0) {
             float de = e - current_position[E_AXIS];
-            for (int i = 1; i < n_segments; ++ i) {
-                float t = float(i) / float(n_segments);
+            for (uint8_t i = 0; i < n_crossings; ++ i) {
+                float t = t_crossings[i];
                 if (saved_printing || (mbl.active == false)) return;
                 plan_buffer_line(
                                  current_position[X_AXIS] + t * dx,
@@ -8903,6 +9076,10 @@ void delay_keep_alive(unsigned int ms)
 }
 
 static void wait_for_heater(long codenum, uint8_t extruder) {
+#ifdef PLANNER_DIAGNOSTICS
+	// The queue runs dry while heating, it is not an underrun.
+	planner_stats_expect_drain();
+#endif /* PLANNER_DIAGNOSTICS */
 
 #ifdef TEMP_RESIDENCY_TIME
 	long residencyStart;
@@ -9865,6 +10042,7 @@ void recover_machine_state_after_power_panic(bool bTiny)
       mbl.active = true;
     mbl.z_values[iy][ix] = float(v) * 0.001f;
   }
+  mbl.invalidate_cell();
 
   // Recover the logical coordinate of the Z axis at the time of the power panic.
   // The current position after power panic is moved to the next closest 0th full step.
@@ -152,6 +152,12 @@ static void spiSend(uint8_t data) {
 //------------------------------------------------------------------------------
 // send command and return error code.  Return zero for OK
 uint8_t Sd2Card::cardCommand(uint8_t cmd, uint32_t arg) {
+#if SD_READ_AHEAD
+  // any other command terminates an open multiple block read
+  if (readAheadOpen_) readAheadEnd();
+  // the block fetched ahead may be overwritten
+  if (cmd == CMD24 || cmd == CMD25 || cmd == CMD38) readAheadValid_ = false;
+#endif  // SD_READ_AHEAD
   // select card
   chipSelectLow();
 
@@ -286,6 +292,9 @@ bool Sd2Card::eraseSingleBlockEnable() {
 bool Sd2Card::init(uint8_t sckRateID, uint8_t chipSelectPin) {
   errorCode_ = type_ = 0;
   chipSelectPin_ = chipSelectPin;
+#if SD_READ_AHEAD
+  readAheadOpen_ = readAheadValid_ = false;
+#endif  // SD_READ_AHEAD
   // 16-bit init start time allows over a minute
   uint16_t t0 = (uint16_t)_millis();
   uint32_t arg;
@@ -373,6 +382,33 @@ bool Sd2Card::init(uint8_t sckRateID, uint8_t chipSelectPin) {
  * the value zero, false, is returned for failure.
  */
 bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
+#if SD_READ_AHEAD
+  {
+    bool sequential = blockNumber == readAheadLast_ + 1;
+    readAheadLast_ = blockNumber;
+    if (readAheadValid_ && blockNumber == readAheadBlock_) {
+      memcpy(dst, readAheadBuf_, 512);
+      readAheadValid_ = false;
+      return true;
+    }
+    if (readAheadOpen_ && blockNumber == readAheadNext_) {
+      if (readData(dst)) {
+        readAheadNext_++;
+        return true;
+      }
+    } else if (sequential && readStart(blockNumber)) {
+      // the second block of a sequence starts a multiple block read
+      readAheadOpen_ = true;
+      readAheadNext_ = blockNumber;
+      if (readData(dst)) {
+        readAheadNext_++;
+        return true;
+      }
+    }
+    // fall back to a single block read
+    errorCode_ = 0;
+  }
+#endif  // SD_READ_AHEAD
 #ifdef SD_CHECK_AND_RETRY
   uint8_t retryCnt = 3;
   // use address if not SDHC card
@@ -422,6 +458,35 @@ bool Sd2Card::readData(uint8_t *dst) {
   return readData(dst, 512);
 }
 
+#if SD_READ_AHEAD
+//------------------------------------------------------------------------------
+/** Fetch the next block of an open multiple block read into the read ahead
+ * buffer, so that a following readBlock() of that block is served from RAM.
+ *
+ * Call while the caller has spare time, for example with the command queue full.
+ *
+ * \return true if a block has been fetched, false if there is no open
+ * multiple block read, the buffer is occupied or the read failed.
+ */
+bool Sd2Card::readAhead() {
+  if (!readAheadOpen_ || readAheadValid_) return false;
+  if (!readData(readAheadBuf_)) {
+    readAheadEnd();
+    errorCode_ = 0;
+    return false;
+  }
+  readAheadBlock_ = readAheadNext_++;
+  readAheadValid_ = true;
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Terminate the open multiple block read. */
+void Sd2Card::readAheadEnd() {
+  readAheadOpen_ = false;
+  readStop();
+}
+#endif  // SD_READ_AHEAD
+
 #ifdef SD_CHECK_AND_RETRY
 static const uint16_t crctab[] PROGMEM = {
   0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
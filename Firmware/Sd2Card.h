@@ -210,6 +210,9 @@ class Sd2Card {
     return readRegister(CMD9, csd);
   }
   bool readData(uint8_t *dst);
+#if SD_READ_AHEAD
+  bool readAhead();
+#endif  // SD_READ_AHEAD
   bool readStart(uint32_t blockNumber);
   bool readStop();
   bool setSckRate(uint8_t sckRateID);
@@ -236,12 +239,27 @@ class Sd2Card {
   uint8_t status_;
   uint8_t type_;
   bool    flash_air_compatible_;
+#if SD_READ_AHEAD
+  // true while a multiple block read is open
+  bool     readAheadOpen_;
+  // true if readAheadBuf_ holds the block readAheadBlock_
+  bool     readAheadValid_;
+  // next block to be delivered by the open multiple block read
+  uint32_t readAheadNext_;
+  uint32_t readAheadBlock_;
+  // last block requested by readBlock(), to detect sequential reads
+  uint32_t readAheadLast_;
+  uint8_t  readAheadBuf_[512];
+#endif  // SD_READ_AHEAD
   // private functions
   uint8_t cardAcmd(uint8_t cmd, uint32_t arg) {
     cardCommand(CMD55, 0);
     return cardCommand(cmd, arg);
   }
   uint8_t cardCommand(uint8_t cmd, uint32_t arg);
+#if SD_READ_AHEAD
+  void readAheadEnd();
+#endif  // SD_READ_AHEAD
 
   bool readData(uint8_t* dst, uint16_t count);
   bool readRegister(uint8_t cmd, void* buf);
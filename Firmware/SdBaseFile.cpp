@@ -30,6 +30,8 @@ void (*SdBaseFile::dateTime_)(uint16_t* date, uint16_t* time) = 0;
 //------------------------------------------------------------------------------
 // add a cluster to a file
 bool SdBaseFile::addCluster() {
+  // the new cluster may not follow the last one
+  flags_ &= ~F_FILE_CONTIGUOUS;
   if (!vol_->allocContiguous(1, &curCluster_)) goto fail;
 
   // if first cluster of file link to directory entry
@@ -129,6 +131,24 @@ bool SdBaseFile::contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock) {
   return false;
 }
 //------------------------------------------------------------------------------
+/** Check whether the clusters of a file follow each other.
+ *
+ * If so, read() and seekSet() calculate the clusters instead of following
+ * the cluster chain through the FAT, so sequential reads of the file never
+ * evict the data block from the volume cache.  The whole chain is walked
+ * once, which takes one FAT block read per 128 (FAT32) or 256 (FAT16) clusters.
+ *
+ * \return The value one, true, is returned for a contiguous file and
+ * the value zero, false, is returned otherwise.
+ */
+bool SdBaseFile::detectContiguous() {
+  uint32_t bgnBlock, endBlock;
+  flags_ &= ~F_FILE_CONTIGUOUS;
+  if (!isFile() || !contiguousRange(&bgnBlock, &endBlock)) return false;
+  flags_ |= F_FILE_CONTIGUOUS;
+  return true;
+}
+//------------------------------------------------------------------------------
 /** Create and open a new contiguous file of a specified size.
  *
  * \note This function only supports short DOS 8.3 names.
@@ -1070,6 +1090,8 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
         if (curPosition_ == 0) {
           // use first cluster in file
           curCluster_ = firstCluster_;
+        } else if (flags_ & F_FILE_CONTIGUOUS) {
+          curCluster_++;
         } else {
           // get next cluster from FAT
           if (!vol_->fatGet(curCluster_, &curCluster_)) goto fail;
@@ -1476,6 +1498,11 @@ bool SdBaseFile::seekSet(uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  if (flags_ & F_FILE_CONTIGUOUS) {
+    curCluster_ = firstCluster_ + nNew;
+    curPosition_ = pos;
+    goto done;
+  }
   if (nNew < nCur || curPosition_ == 0) {
     // must follow chain from first cluster
     curCluster_ = firstCluster_;
@@ -204,6 +204,7 @@ class SdBaseFile {
   //----------------------------------------------------------------------------
   bool close();
   bool contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock);
+  bool detectContiguous();
   bool createContiguous(SdBaseFile* dirFile,
           const char* path, uint32_t size);
   /** \return The current cluster number for a file or directory. */
@@ -333,6 +334,8 @@ class SdBaseFile {
   static uint8_t const F_OFLAG = (O_ACCMODE | O_APPEND | O_SYNC);
   // sync of directory entry required
   static uint8_t const F_FILE_DIR_DIRTY = 0X80;
+  // clusters of the file follow each other, the FAT is not needed to read it
+  static uint8_t const F_FILE_CONTIGUOUS = 0X40;
 
   // private data
   uint8_t   flags_;         // See above for definition of flags_ bits
@@ -103,6 +103,19 @@ uint8_t const SOFT_SPI_MISO_PIN = 12;
 /** Software SPI Clock pin */
 uint8_t const SOFT_SPI_SCK_PIN = 13;
 //------------------------------------------------------------------------------
+/**
+ * Read the blocks of a sequentially read file, like a file being printed, by a
+ * multiple block read (CMD18) kept open between the reads instead of a single
+ * block read (CMD17) each.  The next block of the stream is fetched ahead
+ * into a buffer by Sd2Card::readAhead() while the caller has spare time, so the
+ * buffer and the volume cache form a double buffer.
+ *
+ * Costs 526 bytes of static SRAM, the 512 byte buffer and 14 bytes of the state
+ * in Sd2Card.  The fetch runs in the main loop, not in the background, so it only
+ * moves a block read into the time, when the command queue is full.
+ */
+//#define SD_READ_AHEAD 1
+//------------------------------------------------------------------------------
 /**
  * The __cxa_pure_virtual function is an error handler that is invoked when
  * a pure virtual function is called.
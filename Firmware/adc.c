@@ -1,15 +1,35 @@
 //adc.c
+// The channels are converted in cycles of ADC_CYCLE_SLOTS slots, each taking two adc_cycle() calls
+// (start of the conversion, reading of the result). The channel of each slot is picked on the fly by
+// adc_schedule_next(): the channel in ADC_MEDIAN_MSK three times, the channels in ADC_SLOW_MSK 1 / ADC_SLOW_DIV
+// of the ADC_OVRSAMPL conversions in a cycle, the remaining slots are idle. ADC_CALLBACK is called at the end
+// of each cycle.
 
 #include "adc.h"
+#include "adc_filter.h"
 #include <stdio.h>
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 
 uint8_t adc_state;
-uint8_t adc_count;
 uint16_t adc_values[ADC_CHAN_CNT];
 uint16_t adc_sim_mask;
 
+//! Index of the channel filtered by the median, ADC_CHAN_CNT if none
+#define ADC_MEDIAN_IDX BITCOUNT(ADC_CHAN_MSK & (ADC_MEDIAN_MSK - 1))
+
+static uint8_t adc_slot;
+//! Index of the channel converted in the current slot, ADC_SLOT_IDLE for no conversion
+static uint8_t adc_index;
+//! Conversions of each index in a cycle
+static uint8_t adc_conversions[ADC_CHAN_CNT];
+//! Schedule credits of each index, see adc_schedule_next()
+static int16_t adc_credits[ADC_CHAN_CNT];
+//! Indices with a complete output since adc_reset()
+static uint16_t adc_valid_mask;
+static adc_filter_t adc_filters[ADC_CHAN_CNT];
+static adc_median_t adc_median;
+
 
 #ifdef ADC_CALLBACK
 	extern void ADC_CALLBACK(void);
@@ -26,6 +46,8 @@ void adc_init(void)
 //	ADCSRA |= (1 << ADIF) | (1 << ADSC);
 	DIDR0 = (ADC_CHAN_MSK & 0xff);
 	DIDR2 = (ADC_CHAN_MSK >> 8);
+	uint8_t i; for (i = 0; i < ADC_CHAN_CNT; i++)
+		adc_conversions[i] = ADC_CONVERSIONS(adc_chan(i));
 	adc_reset();
 //	adc_sim_mask = 0b0101;
 //	adc_sim_mask = 0b100101;
@@ -37,10 +59,19 @@ void adc_init(void)
 void adc_reset(void)
 {
 	adc_state = 0;
-	adc_count = 0;
+	adc_slot = 0;
+	adc_valid_mask = 0;
+	adc_median_reset(&adc_median);
 	uint8_t i; for (i = 0; i < ADC_CHAN_CNT; i++)
-	if ((adc_sim_mask & (1 << i)) == 0)
-		adc_values[i] = 0;
+	{
+		adc_credits[i] = 0;
+		adc_filter_reset(&adc_filters[i]);
+		if ((adc_sim_mask & (1 << i)) == 0)
+			adc_values[i] = 0;
+	}
+	adc_index = adc_schedule_next(adc_credits, ADC_CYCLE_SLOTS, adc_conversions, ADC_CHAN_CNT);
+	if (adc_index != ADC_SLOT_IDLE)
+		adc_setmux(adc_chan(adc_index));
 }
 
 void adc_setmux(uint8_t ch)
@@ -64,31 +95,49 @@ uint8_t adc_chan(uint8_t index)
 	return chan;
 }
 
+//! End of a cycle. Until the first complete output of a slow channel, its partial sum is passed on.
+static void adc_cycle_done(void)
+{
+	if (adc_valid_mask != ((1 << ADC_CHAN_CNT) - 1))
+	{
+		uint8_t i; for (i = 0; i < ADC_CHAN_CNT; i++)
+			if (((adc_valid_mask | adc_sim_mask) & (1 << i)) == 0)
+				adc_values[i] = adc_filter_partial(&adc_filters[i], ADC_OVRSAMPL);
+	}
+#ifdef ADC_CALLBACK
+	ADC_CALLBACK();
+#endif //ADC_CALLBACK
+}
+
 void adc_cycle(void)
 {
 	if (adc_state & 0x80)
 	{
-		uint8_t index = adc_state & 0x0f;
-		if ((adc_sim_mask & (1 << index)) == 0)
-			adc_values[index] += ADC;
-		if (++index >= ADC_CHAN_CNT)
+		if (adc_index != ADC_SLOT_IDLE)
 		{
-			index = 0;
-			adc_count++;
-			if (adc_count >= ADC_OVRSAMPL)
+			uint16_t value;
+			if (adc_filter_add(&adc_filters[adc_index], ADC, ADC_OVRSAMPL, &value) &&
+				(adc_index != ADC_MEDIAN_IDX || adc_median_add(&adc_median, value, &value)))
 			{
-#ifdef ADC_CALLBACK
-				ADC_CALLBACK();
-#endif //ADC_CALLBACK
-				adc_reset();
+				adc_valid_mask |= (1 << adc_index);
+				if ((adc_sim_mask & (1 << adc_index)) == 0)
+					adc_values[adc_index] = value;
 			}
 		}
-		adc_setmux(adc_chan(index));
-		adc_state = index;
+		adc_state = 0;
+		if (++adc_slot >= ADC_CYCLE_SLOTS)
+		{
+			adc_slot = 0;
+			adc_cycle_done();
+		}
+		adc_index = adc_schedule_next(adc_credits, ADC_CYCLE_SLOTS, adc_conversions, ADC_CHAN_CNT);
+		if (adc_index != ADC_SLOT_IDLE)
+			adc_setmux(adc_chan(adc_index));
 	}
 	else
 	{
-		ADCSRA |= (1 << ADSC); //start conversion
+		if (adc_index != ADC_SLOT_IDLE)
+			ADCSRA |= (1 << ADSC); //start conversion
 		adc_state |= 0x80;
 	}
 }
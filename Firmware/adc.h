@@ -22,8 +22,20 @@ http://resnet.uoregon.edu/~gurney_j/jmpc/bitwise.html
 # error "ADC_CHAN_MSK oes not match ADC_CHAN_CNT"
 #endif
 
+//! Conversions of a channel in a cycle
+#define ADC_CONVERSIONS(chan) ((ADC_MEDIAN_MSK & (1 << (chan))) ? (3 * ADC_OVRSAMPL) : (ADC_SLOW_MSK & (1 << (chan))) ? (ADC_OVRSAMPL / ADC_SLOW_DIV) : ADC_OVRSAMPL)
+
+#if ((3 * ADC_OVRSAMPL) * BITCOUNT(ADC_CHAN_MSK & ADC_MEDIAN_MSK) + (ADC_OVRSAMPL / ADC_SLOW_DIV) * BITCOUNT(ADC_CHAN_MSK & ADC_SLOW_MSK & ~ADC_MEDIAN_MSK) \
+  + ADC_OVRSAMPL * BITCOUNT(ADC_CHAN_MSK & ~ADC_MEDIAN_MSK & ~ADC_SLOW_MSK)) > ADC_CYCLE_SLOTS
+# error "The conversions of the channels do not fit ADC_CYCLE_SLOTS"
+#endif
+
+#if BITCOUNT(ADC_CHAN_MSK & ADC_MEDIAN_MSK) > 1
+# error "Only one channel of ADC_MEDIAN_MSK is supported"
+#endif
+
 extern uint8_t adc_state;
-extern uint8_t adc_count;
+//! Oversampled values, the sums of ADC_OVRSAMPL conversions
 extern uint16_t adc_values[ADC_CHAN_CNT];
 extern uint16_t adc_sim_mask;
 
@@ -0,0 +1,71 @@
+//adc_filter.c
+
+#include "adc_filter.h"
+
+
+void adc_filter_reset(adc_filter_t* filter)
+{
+	filter->sum = 0;
+	filter->count = 0;
+}
+
+uint8_t adc_filter_add(adc_filter_t* filter, uint16_t sample, uint8_t samples, uint16_t* value)
+{
+	filter->sum += sample;
+	if (++filter->count < samples)
+		return 0;
+	*value = filter->sum;
+	filter->sum = 0;
+	filter->count = 0;
+	return 1;
+}
+
+uint16_t adc_filter_partial(const adc_filter_t* filter, uint8_t samples)
+{
+	if (filter->count == 0)
+		return 0;
+	return (uint32_t)filter->sum * samples / filter->count;
+}
+
+void adc_median_reset(adc_median_t* median)
+{
+	median->groups = 0;
+}
+
+uint8_t adc_median_add(adc_median_t* median, uint16_t sum, uint16_t* value)
+{
+	median->group[median->groups] = sum;
+	if (++median->groups < 3)
+		return 0;
+	median->groups = 0;
+	*value = adc_median3(median->group[0], median->group[1], median->group[2]);
+	return 1;
+}
+
+uint16_t adc_median3(uint16_t a, uint16_t b, uint16_t c)
+{
+	if (a > b) { uint16_t t = a; a = b; b = t; }
+	if (b > c) b = c;
+	return (a > b) ? a : b;
+}
+
+uint8_t adc_schedule_next(int16_t* credit, uint8_t slot_count, const uint8_t* conversions, uint8_t chan_count)
+{
+	uint8_t best = ADC_SLOT_IDLE;
+	int16_t idle = slot_count;
+	int16_t best_credit = 0;
+	uint8_t i; for (i = 0; i < chan_count; i++)
+	{
+		credit[i] += conversions[i];
+		idle -= credit[i];
+		if (best == ADC_SLOT_IDLE || credit[i] > best_credit)
+		{
+			best = i;
+			best_credit = credit[i];
+		}
+	}
+	if (best == ADC_SLOT_IDLE || idle > best_credit)
+		return ADC_SLOT_IDLE;
+	credit[best] -= slot_count;
+	return best;
+}
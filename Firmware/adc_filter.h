@@ -0,0 +1,73 @@
+//! @file
+//! @brief Conversion schedule and filter of the ADC channels, the hardware independent part of adc.c
+//!
+//! A channel is converted in groups of `samples` conversions, their sum is the oversampled value.
+//! A channel filtered by the median outputs the median of the sums of three consecutive groups,
+//! which rejects a burst of noise spoiling one of them.
+
+#ifndef _ADC_FILTER_H
+#define _ADC_FILTER_H
+
+#include <inttypes.h>
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif //defined(__cplusplus)
+
+//! Slot of the schedule without a conversion
+#define ADC_SLOT_IDLE 0xff
+
+typedef struct
+{
+	//! Sum of the current group
+	uint16_t sum;
+	//! Conversions in the current group
+	uint8_t count;
+} adc_filter_t;
+
+//! Median window of a channel filtered by the median of three
+typedef struct
+{
+	//! Complete groups of the current window
+	uint8_t groups;
+	uint16_t group[3];
+} adc_median_t;
+
+extern void adc_filter_reset(adc_filter_t* filter);
+
+//! @brief Add a conversion result to the filter.
+//! @param samples conversions per group, at most 64
+//! @param value filled in with the sum of the group, if complete
+//! @return 1 if the group is complete
+extern uint8_t adc_filter_add(adc_filter_t* filter, uint16_t sample, uint8_t samples, uint16_t* value);
+
+//! @return sum of the current group extrapolated to the whole group, 0 if there is no conversion yet
+extern uint16_t adc_filter_partial(const adc_filter_t* filter, uint8_t samples);
+
+extern void adc_median_reset(adc_median_t* median);
+
+//! @brief Add the sum of a complete group to the median window.
+//! @param value filled in with the median of the three groups of the window, if complete
+//! @return 1 if a new median is ready
+extern uint8_t adc_median_add(adc_median_t* median, uint16_t sum, uint16_t* value);
+
+extern uint16_t adc_median3(uint16_t a, uint16_t b, uint16_t c);
+
+//! @brief Pick the channel converted in the next slot of a cycle of slot_count slots.
+//!
+//! A smooth weighted round robin: in each slot, the credit of every channel grows by its conversions
+//! in a cycle, the channel with the most credit is converted and its credit drops by slot_count.
+//! The idle slots act as one more channel with the remaining conversions, its credit is minus the sum
+//! of the others. The conversions of each channel are spread evenly over the cycle and the credits
+//! are back at zero after slot_count slots, so the schedule repeats every cycle.
+//! @param credit of each channel, zero at the start of a cycle
+//! @param conversions number of conversions of each channel in a cycle, at most slot_count in total
+//! @return channel index or ADC_SLOT_IDLE
+extern uint8_t adc_schedule_next(int16_t* credit, uint8_t slot_count, const uint8_t* conversions, uint8_t chan_count);
+
+
+#if defined(__cplusplus)
+}
+#endif //defined(__cplusplus)
+#endif //_ADC_FILTER_H
@@ -0,0 +1,156 @@
+//! @file
+//! @brief Compact binary framing of the motion and temperature commands streamed over the serial line
+
+#include "binary_gcode.h"
+#include <string.h>
+#include <stdlib.h>
+
+//! CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, not reflected.
+uint16_t binary_gcode_crc(const uint8_t *data, uint8_t len)
+{
+    uint16_t crc = 0xFFFF;
+    while (len --) {
+        crc ^= uint16_t(*data ++) << 8;
+        for (uint8_t i = 0; i < 8; ++ i)
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+    }
+    return crc;
+}
+
+static uint8_t move_frame_length(uint8_t mask)
+{
+    uint8_t len = 4 + 1 + 2;
+    for (; mask; mask >>= 1)
+        if (mask & 1)
+            len += 4;
+    return len;
+}
+
+int8_t binary_gcode_feed(binary_gcode_decoder_t *decoder, uint8_t c, binary_gcode_packet_t *packet)
+{
+    uint8_t *buf = decoder->buf;
+    buf[decoder->count ++] = c;
+    switch (decoder->count) {
+    case 1:
+        if (c != BINARY_GCODE_SYNC)
+            goto frame_error;
+        return BINARY_GCODE_BUSY;
+    case 2:
+        if (c == BINARY_GCODE_TEMPERATURE)
+            decoder->length = 4 + 3 + 2;
+        else if (c != BINARY_GCODE_MOVE)
+            goto frame_error;
+        return BINARY_GCODE_BUSY;
+    case 5:
+        if (buf[1] == BINARY_GCODE_MOVE) {
+            if (c & ~(BINARY_GCODE_X | BINARY_GCODE_Y | BINARY_GCODE_Z | BINARY_GCODE_E | BINARY_GCODE_F))
+                goto frame_error;
+            decoder->length = move_frame_length(c);
+        }
+        break;
+    }
+    if (decoder->length == 0 || decoder->count < decoder->length)
+        return BINARY_GCODE_BUSY;
+
+    // The whole frame has been received.
+    {
+        const uint8_t len = decoder->length;
+        decoder->count = 0;
+        decoder->length = 0;
+        if (binary_gcode_crc(buf + 1, len - 3) != (buf[len - 2] | (uint16_t(buf[len - 1]) << 8)))
+            return BINARY_GCODE_ERR_CRC;
+        packet->type = buf[1];
+        packet->line = buf[2] | (uint16_t(buf[3]) << 8);
+        packet->mask = buf[4];
+        const uint8_t *p = buf + 5;
+        if (packet->type == BINARY_GCODE_TEMPERATURE) {
+            if (packet->mask > BINARY_GCODE_BED)
+                return BINARY_GCODE_ERR_FRAME;
+            packet->value[0] = int16_t(p[0] | (uint16_t(p[1]) << 8));
+        } else {
+            for (uint8_t i = 0; i < 5; ++ i)
+                if (packet->mask & (1 << i)) {
+                    memcpy(&packet->value[i], p, 4);
+                    p += 4;
+                }
+        }
+        return BINARY_GCODE_DONE;
+    }
+
+frame_error:
+    decoder->count = 0;
+    decoder->length = 0;
+    return BINARY_GCODE_ERR_FRAME;
+}
+
+static inline bool is_capital(char c) { return c >= 'A' && c <= 'Z'; }
+static inline bool is_blank(char c) { return c == ' ' || c == '\t'; }
+
+bool binary_gcode_parse_move(const char *cmd, binary_gcode_packet_t *packet)
+{
+    static const char axis_letters[] = "XYZEF";
+    const char *p = cmd;
+    if (*p == '$')
+        while (*++ p >= '0' && *p <= '9');
+    while (is_blank(*p))
+        ++ p;
+    if (p[0] != 'G' || (p[1] != '0' && p[1] != '1'))
+        return false;
+    p += 2;
+    // G10, G1.5 and alike
+    if (*p != 0 && ! is_blank(*p) && ! is_capital(*p))
+        return false;
+    uint8_t mask = 0;
+    for (;;) {
+        while (is_blank(*p))
+            ++ p;
+        if (*p == 0)
+            break;
+        const char *letter = strchr(axis_letters, *p);
+        if (letter == NULL)
+            return false;
+        const uint8_t i = letter - axis_letters;
+        if (mask & (1 << i))
+            return false;
+        char *end;
+        const float value = strtod(p + 1, &end);
+        if (end == p + 1)
+            return false;
+        // A capital letter consumed by strtod(), like the exponent of X1E5, would be a parameter for code_seen().
+        for (++ p; p != end; ++ p)
+            if (is_capital(*p))
+                return false;
+        if (*p != 0 && ! is_blank(*p) && ! is_capital(*p))
+            return false;
+        packet->value[i] = value;
+        mask |= 1 << i;
+    }
+    packet->type = BINARY_GCODE_MOVE;
+    packet->mask = mask;
+    return true;
+}
+
+uint8_t binary_gcode_encode(const binary_gcode_packet_t *packet, uint8_t *frame)
+{
+    uint8_t *p = frame;
+    *p ++ = BINARY_GCODE_SYNC;
+    *p ++ = packet->type;
+    *p ++ = uint8_t(packet->line);
+    *p ++ = uint8_t(packet->line >> 8);
+    *p ++ = packet->mask;
+    if (packet->type == BINARY_GCODE_TEMPERATURE) {
+        const int16_t t = int16_t(packet->value[0]);
+        *p ++ = uint8_t(t);
+        *p ++ = uint8_t(uint16_t(t) >> 8);
+    } else {
+        for (uint8_t i = 0; i < 5; ++ i)
+            if (packet->mask & (1 << i)) {
+                memcpy(p, &packet->value[i], 4);
+                p += 4;
+            }
+    }
+    const uint16_t crc = binary_gcode_crc(frame + 1, uint8_t(p - frame - 1));
+    *p ++ = uint8_t(crc);
+    *p ++ = uint8_t(crc >> 8);
+    return uint8_t(p - frame);
+}
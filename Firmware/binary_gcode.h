@@ -0,0 +1,103 @@
+//! @file
+//! @brief Compact binary framing of the motion and temperature commands streamed over the serial line
+//!
+//! Enabled by M720 S1. The binary packets are interleaved with the text G-code lines, a packet may only start
+//! where a new text line would. Its first byte has the highest bit set, which never starts a text line.
+//!
+//! Frame layout, multi-byte values are little endian:
+//!
+//!     sync(0xA5) type line:uint16 payload crc:uint16
+//!
+//! - `line` - lower 16 bits of the line number N, which has to follow the last line number like a text line.
+//! - `crc` - CRC-16/CCITT-FALSE of the type, line and payload bytes.
+//! - BINARY_GCODE_MOVE payload (G1): an axis mask followed by an IEEE 754 float for each axis present
+//!   in the mask, in the X Y Z E F order.
+//! - BINARY_GCODE_TEMPERATURE payload (M104 / M140): the heater (BINARY_GCODE_HOTEND or BINARY_GCODE_BED)
+//!   followed by an int16 target temperature in degrees Celsius.
+//!
+//! A G1 with all five values takes 27 bytes instead of some 45 characters of a numbered text line.
+
+#ifndef BINARY_GCODE_H
+#define BINARY_GCODE_H
+
+#include <stdint.h>
+
+#define BINARY_GCODE_VERSION 1
+#define BINARY_GCODE_SYNC 0xA5
+
+// Packet types
+#define BINARY_GCODE_MOVE 1
+#define BINARY_GCODE_TEMPERATURE 2
+
+// Move packet axis mask. The bits follow the X_AXIS .. E_AXIS indices.
+#define BINARY_GCODE_X 0x01
+#define BINARY_GCODE_Y 0x02
+#define BINARY_GCODE_Z 0x04
+#define BINARY_GCODE_E 0x08
+#define BINARY_GCODE_F 0x10
+// Index of the feedrate in binary_gcode_packet_t::value
+#define BINARY_GCODE_F_INDEX 4
+
+// Temperature packet heaters
+#define BINARY_GCODE_HOTEND 0
+#define BINARY_GCODE_BED 1
+
+// Longest frame: the header, the axis mask, five floats and the CRC.
+#define BINARY_GCODE_MAX_FRAME (4 + 1 + 5 * 4 + 2)
+
+// binary_gcode_feed() results
+#define BINARY_GCODE_BUSY 0
+#define BINARY_GCODE_DONE 1
+#define BINARY_GCODE_ERR_CRC -1
+#define BINARY_GCODE_ERR_FRAME -2
+
+//! Decoded packet.
+typedef struct
+{
+    uint8_t type;
+    //! Axis mask of a move, the heater of a temperature packet.
+    uint8_t mask;
+    //! Lower 16 bits of the line number.
+    uint16_t line;
+    //! X Y Z E F of a move, the target temperature in value[0] of a temperature packet.
+    float value[5];
+} binary_gcode_packet_t;
+
+//! Frame reassembly state. Zero initialized means waiting for the sync byte.
+typedef struct
+{
+    uint8_t count;
+    //! Length of the frame being received, 0 until the type and the axis mask are known.
+    uint8_t length;
+    uint8_t buf[BINARY_GCODE_MAX_FRAME];
+} binary_gcode_decoder_t;
+
+uint16_t binary_gcode_crc(const uint8_t *data, uint8_t len);
+
+//! @brief Feed one byte of a frame to the decoder.
+//!
+//! The first byte fed has to be BINARY_GCODE_SYNC. The decoder is ready for the next frame
+//! after any result other than BINARY_GCODE_BUSY.
+//! @param packet filled in if BINARY_GCODE_DONE is returned
+//! @return BINARY_GCODE_BUSY, BINARY_GCODE_DONE, BINARY_GCODE_ERR_CRC or BINARY_GCODE_ERR_FRAME
+int8_t binary_gcode_feed(binary_gcode_decoder_t *decoder, uint8_t c, binary_gcode_packet_t *packet);
+
+//! @return true while a frame is being received
+static inline bool binary_gcode_busy(const binary_gcode_decoder_t *decoder) { return decoder->count != 0; }
+
+//! @brief Parse a plain G0 / G1 text command into a move packet.
+//!
+//! Accepts an optional line number prefix ('$' and digits, as left in cmdbuffer), G0 or G1 and the X Y Z E F
+//! parameters, each at most once, with no other capital letters in the line. The values are converted by strtod()
+//! like code_value() does, so the packet matches what code_seen() / code_value() read from the text.
+//! Anything else is left to the text parser.
+//! @param packet filled in with the type and the values, the line number is left untouched
+//! @return false if the command is not a plain move
+bool binary_gcode_parse_move(const char *cmd, binary_gcode_packet_t *packet);
+
+//! @brief Build the frame of a packet, used by the host side.
+//! @param frame at least BINARY_GCODE_MAX_FRAME bytes
+//! @return length of the frame
+uint8_t binary_gcode_encode(const binary_gcode_packet_t *packet, uint8_t *frame);
+
+#endif /* BINARY_GCODE_H */
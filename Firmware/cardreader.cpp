@@ -9,11 +9,65 @@
 
 #define LONGEST_FILENAME (longFilename[0] ? longFilename : filename)
 
+#ifdef SDCARD_SORT_ALPHA
+// The sort order of the recently visited directories is kept on the card, so that a directory is sorted again
+// only after its content has changed. The index file in the root directory consists of SDSORT_INDEX_SLOTS slots,
+// a directory is stored in the slot selected by its first cluster. A slot starts with a sort_index_header_t
+// followed by up to SDSORT_LIMIT sort_index_record_t in the sorted order.
+#define SORT_INDEX_NAME "SORTIDX.BIN"
+#define SORT_INDEX_VERSION 1
+
+typedef struct
+{
+	uint32_t dirCluster;  // First cluster of the directory
+	uint32_t checksum;    // sort_checksum of the directory when sorted
+	uint16_t count;       // Number of the records
+	uint8_t sdSort;       // SD_SORT_ALPHA or SD_SORT_TIME
+	uint8_t version;
+} sort_index_header_t;
+
+typedef struct
+{
+	uint16_t start;       // Index of the first directory entry of the item, its long name entries included
+	uint16_t hash;        // sort_entry_hash() of the item, detects an item changed or replaced in place
+} sort_index_record_t;
+
+#define SORT_INDEX_SLOT_SIZE (sizeof(sort_index_header_t) + SDSORT_LIMIT * sizeof(sort_index_record_t))
+#define SORT_INDEX_SIZE (SDSORT_INDEX_SLOTS * SORT_INDEX_SLOT_SIZE)
+
+/**
+* Index of the first directory entry of the item read last, given the directory position after its short entry.
+* getfilename_simple() of this index reads the item including its long name.
+*/
+static uint16_t sort_entry_start(uint32_t end, const char *longFilename)
+{
+	const uint8_t lfnEntries = (strnlen(longFilename, MAX_VFAT_ENTRIES * 13) + 12) / 13;
+	return uint16_t(end >> 5) - 1 - lfnEntries;
+}
+
+static inline uint16_t sort_hash_add(uint16_t hash, uint8_t c)
+{
+	return ((hash << 5) | (hash >> 11)) ^ c;
+}
+
+static uint16_t sort_entry_hash(const char *name, const char *longFilename, uint16_t date, uint16_t time)
+{
+	uint16_t hash = date;
+	for (; *name; ++ name)
+		hash = sort_hash_add(hash, *name);
+	for (uint8_t i = 0; i < MAX_VFAT_ENTRIES * 13 && longFilename[i]; ++ i)
+		hash = sort_hash_add(hash, longFilename[i]);
+	hash = sort_hash_add(hash, time & 0xFF);
+	return sort_hash_add(hash, time >> 8);
+}
+#endif // SDCARD_SORT_ALPHA
+
 CardReader::CardReader()
 {
 
    #ifdef SDCARD_SORT_ALPHA
      sort_count = 0;
+     sort_in_ram = false;
      #if SDSORT_GCODE
        sort_alpha = true;
      sort_folders = FOLDER_SORTING;
@@ -21,6 +75,7 @@ CardReader::CardReader()
      #endif
    #endif
 
+   flush_name_cache();
    filesize = 0;
    sdpos = 0;
    sdprinting = false;
@@ -112,6 +167,16 @@ void CardReader::lsDive(const char *prepend, SdFile parent, const char * const m
 				switch (lsAction) {
 					case LS_Count:
 						nrFiles++;
+					#ifdef SDCARD_SORT_ALPHA
+						{
+							// Any item added, removed, renamed or moved changes the checksum.
+							char name[FILENAME_LENGTH];
+							createFilename(name, p);
+							const uint16_t start = sort_entry_start(parent.curPosition(), longFilename);
+							const uint16_t hash = sort_entry_hash(name, longFilename, p.lastWriteDate, p.lastWriteTime);
+							sort_checksum = ((sort_checksum << 7) | (sort_checksum >> 25)) ^ (uint32_t(start) << 16) ^ hash;
+						}
+					#endif
 						break;
 					
 					case LS_SerialPrint:
@@ -165,6 +230,10 @@ void CardReader::ls()
 void CardReader::initsd()
 {
   cardOK = false;
+#ifdef SDCARD_SORT_ALPHA
+  if(sort_index.isOpen())
+    sort_index.close();
+#endif
   if(root.isOpen())
     root.close();
 #ifdef SDSLOW
@@ -204,6 +273,7 @@ void CardReader::initsd()
   workDir=root;
   curDir=&root;
   workDirDepth = 0;
+  flush_name_cache();
 
   #ifdef SDCARD_SORT_ALPHA
 	presort();
@@ -227,6 +297,7 @@ void CardReader::setroot()
   workDir=root;
   
   curDir=&workDir;
+  flush_name_cache();
   #ifdef SDCARD_SORT_ALPHA
 	  presort();
   #endif
@@ -419,6 +490,8 @@ void CardReader::openFile(const char* name,bool read, bool replace_current/*=tru
   {
     if (file.open(curDir, fname, O_READ)) 
     {
+      // Read a contiguous file without the FAT lookups at the cluster boundaries.
+      file.detectContiguous();
       filesize = file.fileSize();
       SERIAL_PROTOCOLRPGM(_N("File opened: "));////MSG_SD_FILE_OPENED
       SERIAL_PROTOCOL(fname);
@@ -449,6 +522,7 @@ void CardReader::openFile(const char* name,bool read, bool replace_current/*=tru
     else
     {
       saving = true;
+      flush_name_cache();
       SERIAL_PROTOCOLRPGM(_N("Writing to file: "));////MSG_SD_WRITE_TO_FILE
       SERIAL_PROTOCOLLN(name);
       lcd_setstatus(fname);
@@ -472,6 +546,7 @@ void CardReader::removeFile(const char* name)
       SERIAL_PROTOCOLPGM("File deleted:");
       SERIAL_PROTOCOLLN(fname);
       sdpos = 0;
+      flush_name_cache();
 	  #ifdef SDCARD_SORT_ALPHA
 		  presort();
 	  #endif
@@ -644,12 +719,82 @@ uint16_t CardReader::getnrfilenames()
   curDir=&workDir;
   lsAction=LS_Count;
   nrFiles=0;
+#ifdef SDCARD_SORT_ALPHA
+  sort_checksum = 0;
+#endif
   curDir->rewind();
   lsDive("",*curDir);
   //SERIAL_ECHOLN(nrFiles);
   return nrFiles;
 }
 
+#if SDCARD_NAME_CACHE_BYTES > 0
+#define NAME_CACHE_SORTED 0x8000
+#define NAME_CACHE_EMPTY 0xFFFF
+#endif
+
+void CardReader::getfilename_cached(uint16_t nr, bool sorted)
+{
+#if SDCARD_NAME_CACHE_BYTES > 0
+  const uint16_t key = sorted ? (nr | NAME_CACHE_SORTED) : nr;
+  name_cache_t *entry = name_cache;
+  for (name_cache_t *e = name_cache; e != name_cache + SD_NAME_CACHE_SIZE; ++ e)
+  {
+    if (e->nr == key)
+    {
+      entry = e;
+      strcpy(filename, e->filename);
+      strcpy(longFilename, e->longFilename);
+      filenameIsDir = e->isDir;
+      goto touch;
+    }
+    // Replace the least recently used entry on a miss.
+    if (e->age > entry->age)
+      entry = e;
+  }
+#endif
+#ifdef SDCARD_SORT_ALPHA
+  if (sorted)
+    getfilename_sorted(nr);
+  else
+#endif
+    getfilename(nr);
+#if SDCARD_NAME_CACHE_BYTES > 0
+  entry->nr = key;
+  strcpy(entry->filename, filename);
+  strcpy(entry->longFilename, longFilename);
+  entry->isDir = filenameIsDir;
+touch:
+  for (name_cache_t *e = name_cache; e != name_cache + SD_NAME_CACHE_SIZE; ++ e)
+    if (e->age < entry->age)
+      ++ e->age;
+  entry->age = 0;
+#endif
+}
+
+uint16_t CardReader::getnrfilenames_cached()
+{
+#if SDCARD_NAME_CACHE_BYTES > 0
+  if (name_cache_count == NAME_CACHE_EMPTY)
+    name_cache_count = getnrfilenames();
+  return name_cache_count;
+#else
+  return getnrfilenames();
+#endif
+}
+
+void CardReader::flush_name_cache()
+{
+#if SDCARD_NAME_CACHE_BYTES > 0
+  for (uint8_t i = 0; i < SD_NAME_CACHE_SIZE; ++ i)
+  {
+    name_cache[i].nr = NAME_CACHE_EMPTY;
+    name_cache[i].age = i;
+  }
+  name_cache_count = NAME_CACHE_EMPTY;
+#endif
+}
+
 void CardReader::chdir(const char * relpath)
 {
   SdFile newfile;
@@ -672,6 +817,7 @@ void CardReader::chdir(const char * relpath)
       workDirParents[0]=*parent;
     }
     workDir=newfile;
+    flush_name_cache();
 	#ifdef SDCARD_SORT_ALPHA
 		presort();
 	#endif
@@ -688,6 +834,7 @@ void CardReader::updir()
     {
         workDirParents[d] = workDirParents[d+1];
     }
+    flush_name_cache();
 	#ifdef SDCARD_SORT_ALPHA
     presort();
 	#endif
@@ -700,23 +847,276 @@ void CardReader::updir()
 * Get the name of a file in the current directory by sort-index
 */
 void CardReader::getfilename_sorted(const uint16_t nr) {
-	getfilename(
+	if (
 	#if SDSORT_GCODE
 		sort_alpha &&
 	#endif
-		(nr < sort_count) ? sort_order[nr] : nr
-	);
+		nr < sort_count) {
+		if (sort_in_ram) {
+			getfilename(sort_order[nr]);
+			return;
+		}
+		sort_index_record_t record;
+		if (sort_index.seekSet(sort_index_slot() + sizeof(sort_index_header_t) + nr * sizeof(record)) &&
+			sort_index.read(&record, sizeof(record)) == sizeof(record)) {
+			getfilename_simple(uint32_t(record.start) << 5);
+			return;
+		}
+	}
+	getfilename(nr);
+}
+
+/**
+* Open the sort index, create it with all its slots empty if it does not exist.
+*/
+bool CardReader::sort_index_open() {
+	if (sort_index.isOpen())
+		return true;
+	if (sort_index.open(root, SORT_INDEX_NAME, O_RDWR)) {
+		if (sort_index.fileSize() == SORT_INDEX_SIZE)
+			return true;
+		// Written with other SDSORT_LIMIT or SDSORT_INDEX_SLOTS
+		sort_index.close();
+	}
+	if (!sort_index.open(root, SORT_INDEX_NAME, O_RDWR | O_CREAT | O_TRUNC))
+		return false;
+	uint8_t zero[32];
+	memset(zero, 0, sizeof(zero));
+	for (uint16_t i = SORT_INDEX_SIZE; i > 0;) {
+		const uint16_t n = (i < sizeof(zero)) ? i : sizeof(zero);
+		if (sort_index.write(zero, n) != n)
+			goto fail;
+		i -= n;
+	}
+	if (sort_index.sync())
+		return true;
+fail:
+	sort_index.close();
+	return false;
+}
+
+/**
+* Offset of the slot of the current directory in the sort index
+*/
+uint32_t CardReader::sort_index_slot() {
+	return (workDir.firstCluster() % SDSORT_INDEX_SLOTS) * SORT_INDEX_SLOT_SIZE;
+}
+
+/**
+* Compare an item with the item read last by getfilename()
+* @return true if the item belongs after the one read last
+*/
+bool CardReader::sort_after(const char *name1, uint16_t date1, uint16_t time1, bool dir1, uint8_t sdSort) {
+	#if HAS_FOLDER_SORTING
+	if (dir1 != filenameIsDir)
+		return (sdSort == SD_SORT_TIME) ? (FOLDER_SORTING < 0 ? dir1 : !dir1) : (FOLDER_SORTING > 0 ? dir1 : !dir1);
+	#endif
+	if (sdSort == SD_SORT_TIME)
+		return date1 > modificationDate || (date1 == modificationDate && time1 > modificationTime);
+	return strcasecmp(name1, LONGEST_FILENAME) > 0;
+}
+
+// Short sort key of an item. Most comparisons are decided by the keys held in RAM, without reading the names from the card.
+struct sort_key_t
+{
+	uint8_t key[8];       // First characters of the name in lower case as strcasecmp() compares them, or the big endian time stamp
+	uint16_t start;       // see sort_index_record_t
+	uint16_t hash;
+	bool dir;
+};
+
+// Length of the runs sorted in RAM by presort_merge(), which merges at most this many runs.
+#define SORT_ARENA 16
+#if SDSORT_LIMIT > SORT_ARENA * SORT_ARENA
+#error "SDSORT_LIMIT is too high for the merge of SORT_ARENA runs"
+#endif
+
+/**
+* Fill the sort key of the item read last by getfilename()
+*/
+void CardReader::sort_key_load(sort_key_t &k, uint8_t sdSort) {
+	k.start = sort_entry_start(position, longFilename);
+	k.hash = sort_entry_hash(filename, longFilename, modificationDate, modificationTime);
+	k.dir = filenameIsDir;
+	memset(k.key, 0, sizeof(k.key));
+	if (sdSort == SD_SORT_TIME) {
+		k.key[0] = modificationDate >> 8;
+		k.key[1] = modificationDate & 0xFF;
+		k.key[2] = modificationTime >> 8;
+		k.key[3] = modificationTime & 0xFF;
+	} else {
+		const char *name = LONGEST_FILENAME;
+		for (uint8_t i = 0; i < sizeof(k.key) && name[i]; ++ i)
+			k.key[i] = tolower(name[i]);
+	}
+}
+
+/**
+* Compare two items like sort_after(), reading the names from the card only if they share the key.
+*/
+bool CardReader::sort_key_after(const sort_key_t &a, const sort_key_t &b, uint8_t sdSort) {
+	#if HAS_FOLDER_SORTING
+	if (a.dir != b.dir)
+		return (sdSort == SD_SORT_TIME) ? (FOLDER_SORTING < 0 ? a.dir : !a.dir) : (FOLDER_SORTING > 0 ? a.dir : !a.dir);
+	#endif
+	const int c = memcmp(a.key, b.key, sizeof(a.key));
+	if (c != 0)
+		return c > 0;
+	// Equal time stamps or names shorter than the key
+	if (sdSort == SD_SORT_TIME || memchr(a.key, 0, sizeof(a.key)) != NULL)
+		return false;
+	char name1[LONG_FILENAME_LENGTH + 1];
+	getfilename_simple(uint32_t(a.start) << 5);
+	strcpy(name1, LONGEST_FILENAME);
+	getfilename_simple(uint32_t(b.start) << 5);
+	return strcasecmp(name1, LONGEST_FILENAME) > 0;
+}
+
+/**
+* Fill the progress bar of the sorting screen
+*/
+static void sort_progress(uint16_t done, uint16_t total) {
+	for (uint8_t column = uint32_t(done - 1) * 20 / total; column < uint32_t(done) * 20 / total; ++ column) {
+		lcd_set_cursor(column, 2);
+		lcd_print('\x01'); //simple progress bar
+	}
+}
+
+/**
+* Write the sort index records of the sorted items at offset
+*
+* The records are written in batches, so that the index block is written once per batch
+* and not for each name read in between.
+*/
+bool CardReader::presort_store(uint32_t offset, const uint16_t *order, uint16_t n) {
+	if (!sort_index.seekSet(offset))
+		return false;
+	for (uint16_t i = 0; i < n;) {
+		sort_index_record_t records[16];
+		uint8_t m = 0;
+		for (; m < 16 && i < n; ++ m, ++ i) {
+			getfilename_simple(uint32_t(order[i]) << 5);
+			records[m].start = order[i];
+			records[m].hash = sort_entry_hash(filename, longFilename, modificationDate, modificationTime);
+		}
+		if (sort_index.write(records, m * sizeof(records[0])) != int16_t(m * sizeof(records[0])))
+			return false;
+	}
+	return true;
+}
+
+/**
+* Sort the first n items of the current directory and write their sort index records at offset
+*
+* The items are read in the directory order in runs of SORT_ARENA, each run is sorted by insertion
+* of the short keys in RAM and kept in order. The runs are then merged, reading each item once more
+* for the key of the head of its run. Each item is read twice in total, the names are compared
+* only if their first characters are equal.
+*/
+bool CardReader::presort_merge(uint32_t offset, uint16_t *order, uint16_t n, uint8_t sdSort) {
+	sort_key_t keys[SORT_ARENA];
+	uint32_t pos = 0;
+	for (uint16_t i = 0; i < n; i += SORT_ARENA) {
+		const uint8_t m = (n - i < SORT_ARENA) ? (n - i) : SORT_ARENA;
+		for (uint8_t j = 0; j < m; ++ j) {
+			if (!IS_SD_INSERTED) return false;
+			manage_heater();
+			getfilename_simple(pos);
+			pos = position;
+			sort_key_t key;
+			sort_key_load(key, sdSort);
+			uint8_t k = j;
+			for (; k > 0 && sort_key_after(keys[k - 1], key, sdSort); -- k)
+				keys[k] = keys[k - 1];
+			keys[k] = key;
+			sort_progress(i + j + 1, 2 * n);
+		}
+		for (uint8_t j = 0; j < m; ++ j)
+			order[i + j] = keys[j].start;
+	}
+
+	// Merge the runs, keys[r] holds the head of the run r.
+	const uint8_t runs = (n + SORT_ARENA - 1) / SORT_ARENA;
+	uint16_t head[runs];
+	for (uint8_t r = 0; r < runs; ++ r) {
+		head[r] = r * SORT_ARENA;
+		getfilename_simple(uint32_t(order[head[r]]) << 5);
+		sort_key_load(keys[r], sdSort);
+	}
+	if (!sort_index.seekSet(offset))
+		return false;
+	sort_index_record_t records[16];
+	uint8_t m = 0;
+	for (uint16_t i = 0; i < n; ++ i) {
+		if (!IS_SD_INSERTED) return false;
+		manage_heater();
+		// The first run wins a tie, which keeps the directory order of equal items.
+		uint8_t best = 0xFF;
+		for (uint8_t r = 0; r < runs; ++ r)
+			if (head[r] < n && head[r] < (r + 1) * SORT_ARENA && (best == 0xFF || sort_key_after(keys[best], keys[r], sdSort)))
+				best = r;
+		records[m].start = keys[best].start;
+		records[m].hash = keys[best].hash;
+		if (++ m == 16 || i + 1 == n) {
+			if (sort_index.write(records, m * sizeof(records[0])) != int16_t(m * sizeof(records[0])))
+				return false;
+			m = 0;
+		}
+		if (++ head[best] < n && head[best] < (best + 1) * SORT_ARENA) {
+			getfilename_simple(uint32_t(order[head[best]]) << 5);
+			sort_key_load(keys[best], sdSort);
+		}
+		sort_progress(n + i + 1, 2 * n);
+	}
+	return true;
+}
+
+static bool sort_contains(const uint16_t *order, uint16_t n, uint16_t start)
+{
+	while (n --)
+		if (*order ++ == start)
+			return true;
+	return false;
+}
+
+/**
+* Keep the order of the first n items of the current directory in RAM as their directory indices,
+* if it cannot be stored in the sort index
+*/
+void CardReader::presort_ram(const uint16_t *order, uint16_t n) {
+	for (uint16_t k = 0; k < n; ++ k)
+		sort_order[k] = k;
+	uint32_t pos = 0;
+	for (uint16_t i = 0; i < n; ++ i) {
+		if (!IS_SD_INSERTED) return;
+		manage_heater();
+		getfilename_simple(pos);
+		pos = position;
+		const uint16_t start = sort_entry_start(position, longFilename);
+		for (uint16_t k = 0; k < n; ++ k)
+			if (order[k] == start) {
+				sort_order[k] = i;
+				break;
+			}
+	}
+	sort_in_ram = true;
+	sort_count = n;
 }
 
 /**
-* Read all the files and produce a sort key
+* Sort the items of the current directory
 *
-* We can do this in 3 ways...
-*  - Minimal RAM: Read two filenames at a time sorting along...
-*  - Some RAM: Buffer the directory just for this sort
-*  - Most RAM: Buffer the directory and return filenames from RAM
+* The order is looked up in the sort index on the card. If the directory has changed since,
+* the items still present keep their order and the new ones are placed by a binary search,
+* each comparison reading one name from the card. If most of the items are new, all of them
+* are sorted by presort_merge(). The order is held on the stack meanwhile.
+*
+* If the sort index cannot be created or written, e.g. on a write protected card, the items
+* are placed one by one and the order is kept in RAM by presort_ram().
 */
 void CardReader::presort() {
+	// The order of the items may change.
+	flush_name_cache();
 	if (farm_mode || IS_SD_INSERTED == false) return; //sorting is not used in farm mode
 	uint8_t sdSort = eeprom_read_byte((uint8_t*)EEPROM_SD_SORT);
 
@@ -732,254 +1132,110 @@ void CardReader::presort() {
 
 	// If there are files, sort up to the limit
 	uint16_t fileCnt = getnrfilenames();
-	if (fileCnt > 0) {
+	if (fileCnt > 1) {
+		const bool indexed = sort_index_open();
+		const uint32_t slot = sort_index_slot();
+		sort_index_header_t header;
+		bool incremental = indexed && sort_index.seekSet(slot) && sort_index.read(&header, sizeof(header)) == sizeof(header) &&
+			header.version == SORT_INDEX_VERSION && header.dirCluster == workDir.firstCluster() && header.sdSort == sdSort;
 
 		// Never sort more than the max allowed
 		// If you use folders to organize, 20 may be enough
 		if (fileCnt > SDSORT_LIMIT) {
 			lcd_show_fullscreen_message_and_wait_P(_i("Some files will not be sorted. Max. No. of files in 1 folder for sorting is 100."));////MSG_FILE_CNT c=20 r=4
 			fileCnt = SDSORT_LIMIT;
+			// Only the first SDSORT_LIMIT items in the directory order may be sorted.
+			incremental = incremental && header.checksum == sort_checksum;
 		}
-		lcd_clear();
-		#if !SDSORT_USES_RAM
+
+		if (incremental && header.checksum == sort_checksum && header.count == fileCnt) {
+			// The directory did not change since it was sorted.
+			sort_count = fileCnt;
+		} else {
+			lcd_clear();
 			lcd_set_progress();
-		#endif
-		lcd_puts_at_P(0, 1, _i("Sorting files"));////MSG_SORTING c=20 r=1
-
-		// Sort order is always needed. May be static or dynamic.
-		#if SDSORT_DYNAMIC_RAM
-		sort_order = new uint8_t[fileCnt];
-		#endif
-
-		// Use RAM to store the entire directory during pre-sort.
-		// SDSORT_LIMIT should be set to prevent over-allocation.
-		#if SDSORT_USES_RAM
-
-		// If using dynamic ram for names, allocate on the heap.
-		#if SDSORT_CACHE_NAMES
-		#if SDSORT_DYNAMIC_RAM
-		sortshort = new char*[fileCnt];
-		sortnames = new char*[fileCnt];
-		#endif
-		#elif SDSORT_USES_STACK
-		char sortnames[fileCnt][LONG_FILENAME_LENGTH];
-		uint16_t modification_time[fileCnt];
-		uint16_t modification_date[fileCnt];
-		#endif
-
-		// Folder sorting needs 1 bit per entry for flags.
-		#if HAS_FOLDER_SORTING
-		#if SDSORT_DYNAMIC_RAM
-		isDir = new uint8_t[(fileCnt + 7) >> 3];
-		#elif SDSORT_USES_STACK
-		uint8_t isDir[(fileCnt + 7) >> 3];
-		#endif
-		#endif
-
-		#else // !SDSORT_USES_RAM
-
-		uint32_t positions[fileCnt];
-
-		// By default re-read the names from SD for every compare
-		// retaining only two filenames at a time. This is very
-		// slow but is safest and uses minimal RAM.
-		char name1[LONG_FILENAME_LENGTH + 1];
-		uint16_t modification_time_bckp;
-		uint16_t modification_date_bckp;
-
-		#endif
-		position = 0;
-		if (fileCnt > 1) {
-			// Init sort order.
-			for (uint16_t i = 0; i < fileCnt; i++) {
-				if (!IS_SD_INSERTED) return;
-				manage_heater();
-				sort_order[i] = i;
-				positions[i] = position;
-				getfilename(i);
-				// If using RAM then read all filenames now.
-				#if SDSORT_USES_RAM
-				getfilename(i);
-				#if SDSORT_DYNAMIC_RAM
-				// Use dynamic method to copy long filename
-				sortnames[i] = strdup(LONGEST_FILENAME);
-				#if SDSORT_CACHE_NAMES
-				// When caching also store the short name, since
-				// we're replacing the getfilename() behavior.
-				sortshort[i] = strdup(filename);
-				#endif
-				#else
-				// Copy filenames into the static array
-				strcpy(sortnames[i], LONGEST_FILENAME);
-				modification_time[i] = modificationTime;
-				modification_date[i] = modificationDate;
-				#if SDSORT_CACHE_NAMES
-				strcpy(sortshort[i], filename);
-				#endif
-				#endif
-				// char out[30];
-				// sprintf_P(out, PSTR("---- %i %s %s"), i, filenameIsDir ? "D" : " ", sortnames[i]);
-				// SERIAL_ECHOLN(out);
-				#if HAS_FOLDER_SORTING
-				const uint16_t bit = i & 0x07, ind = i >> 3;
-				if (bit == 0) isDir[ind] = 0x00;
-				if (filenameIsDir) isDir[ind] |= _BV(bit);
-				#endif
-				#endif
+			lcd_puts_at_P(0, 1, _i("Sorting files"));////MSG_SORTING c=20 r=1
+
+			uint16_t order[fileCnt];
+			uint16_t n = 0;
+			// Keep the order of the items, which did not change.
+			if (incremental) {
+				sort_index_record_t record;
+				for (uint16_t i = 0; i < header.count && n < fileCnt && sort_index.read(&record, sizeof(record)) == sizeof(record); ++ i) {
+					if (!IS_SD_INSERTED) return;
+					manage_heater();
+					getfilename_simple(uint32_t(record.start) << 5);
+					if (sort_entry_start(position, longFilename) == record.start &&
+						sort_entry_hash(filename, longFilename, modificationDate, modificationTime) == record.hash &&
+						!sort_contains(order, n, record.start))
+						order[n ++] = record.start;
+				}
 			}
 
-#ifdef QUICKSORT
-			quicksort(0, fileCnt - 1);
-#else //Qicksort not defined, use Bubble Sort
-			uint32_t counter = 0;
-			uint16_t total = 0.5*(fileCnt - 1)*(fileCnt);
-
-			// Compare names from the array or just the two buffered names
-			#if SDSORT_USES_RAM
-			#define _SORT_CMP_NODIR() (strcasecmp(sortnames[o1], sortnames[o2]) > 0)
-			#define _SORT_CMP_TIME_NODIR() (((modification_date[o1] == modification_date[o2]) && (modification_time[o1] < modification_time[o2])) || \
-																	(modification_date[o1] < modification_date [o2]))
-			#else
-			#define _SORT_CMP_NODIR() (strcasecmp(name1, name2) > 0) //true if lowercase(name1) > lowercase(name2)
-			#define _SORT_CMP_TIME_NODIR() (((modification_date_bckp == modificationDate) && (modification_time_bckp > modificationTime)) || \
-																	(modification_date_bckp > modificationDate))
-
-			#endif
-
-			#if HAS_FOLDER_SORTING
-			#if SDSORT_USES_RAM
-			// Folder sorting needs an index and bit to test for folder-ness.
-			const uint8_t ind1 = o1 >> 3, bit1 = o1 & 0x07,
-				ind2 = o2 >> 3, bit2 = o2 & 0x07;
-			#define _SORT_CMP_DIR(fs) \
-										  (((isDir[ind1] & _BV(bit1)) != 0) == ((isDir[ind2] & _BV(bit2)) != 0) \
-											? _SORT_CMP_NODIR() \
-											: (isDir[fs > 0 ? ind1 : ind2] & (fs > 0 ? _BV(bit1) : _BV(bit2))) != 0)
-			#define _SORT_CMP_TIME_DIR(fs) \
-										  (((isDir[ind1] & _BV(bit1)) != 0) == ((isDir[ind2] & _BV(bit2)) != 0) \
-											? _SORT_CMP_TIME_NODIR() \
-											: (isDir[fs > 0 ? ind1 : ind2] & (fs > 0 ? _BV(bit1) : _BV(bit2))) != 0)
-			#else
-			#define _SORT_CMP_DIR(fs) ((dir1 == filenameIsDir) ? _SORT_CMP_NODIR() : (fs > 0 ? dir1 : !dir1))
-			#define _SORT_CMP_TIME_DIR(fs) ((dir1 == filenameIsDir) ? _SORT_CMP_TIME_NODIR() : (fs < 0 ? dir1 : !dir1))
-			#endif
-			#endif
-
-			for (uint16_t i = fileCnt; --i;) {
+			bool stored = false;
+			if (indexed && n < fileCnt / 2) {
+				// Sort all the items.
+				stored = presort_merge(slot + sizeof(header), order, fileCnt, sdSort);
 				if (!IS_SD_INSERTED) return;
-				bool didSwap = false;
-
-				#if !SDSORT_USES_RAM //show progresss bar only if slow sorting method is used
-				int8_t percent = (counter * 100) / total;//((counter * 100) / pow((fileCnt-1),2));
-				for (int column = 0; column < 20; column++) {
-					if (column < (percent / 5))
-					{
-						lcd_set_cursor(column, 2);
-						lcd_print('\x01'); //simple progress bar
-					}
-				}
-				counter++;
-				#endif
-
-				//MYSERIAL.println(int(i));
-				for (uint16_t j = 0; j < i; ++j) {
+				// Otherwise the runs left in order are placed again below.
+				n = stored ? fileCnt : 0;
+			}
+			if (!stored) {
+				// Only a few items are new, place them one by one.
+				char name1[LONG_FILENAME_LENGTH + 1];
+				uint32_t pos = 0;
+				for (uint16_t i = 0; i < fileCnt; ++ i) {
 					if (!IS_SD_INSERTED) return;
 					manage_heater();
-					const uint16_t o1 = sort_order[j], o2 = sort_order[j + 1];
-
-					// The most economical method reads names as-needed
-					// throughout the loop. Slow if there are many.
-					#if !SDSORT_USES_RAM
-					counter++;
-					getfilename_simple(positions[o1]);
+					getfilename_simple(pos);
+					pos = position;
+					const uint16_t start = sort_entry_start(position, longFilename);
+					if (sort_contains(order, n, start))
+						continue;
 					strcpy(name1, LONGEST_FILENAME); // save (or getfilename below will trounce it)
-					modification_date_bckp = modificationDate;
-					modification_time_bckp = modificationTime;
-					#if HAS_FOLDER_SORTING
-					bool dir1 = filenameIsDir;
-					#endif
-					getfilename_simple(positions[o2]);
-					char *name2 = LONGEST_FILENAME; // use the string in-place
-
-					#endif // !SDSORT_USES_RAM
-
-													// Sort the current pair according to settings.
-					if (
-					#if HAS_FOLDER_SORTING
-					(sdSort == SD_SORT_TIME && _SORT_CMP_TIME_DIR(FOLDER_SORTING)) || (sdSort == SD_SORT_ALPHA && _SORT_CMP_DIR(FOLDER_SORTING))
-					#else
-						(sdSort == SD_SORT_TIME && _SORT_CMP_TIME_NODIR()) || (sdSort == SD_SORT_ALPHA && _SORT_CMP_NODIR())
-					#endif
-						)
-					{
-						sort_order[j] = o2;
-						sort_order[j + 1] = o1;
-						didSwap = true;
+					const uint16_t date1 = modificationDate, time1 = modificationTime;
+					const bool dir1 = filenameIsDir;
+					uint16_t lo = 0, hi = n;
+					while (lo < hi) {
+						const uint16_t mid = (lo + hi) / 2;
+						getfilename_simple(uint32_t(order[mid]) << 5);
+						if (sort_after(name1, date1, time1, dir1, sdSort))
+							lo = mid + 1;
+						else
+							hi = mid;
 					}
+					memmove(order + lo + 1, order + lo, (n - lo) * sizeof(order[0]));
+					order[lo] = start;
+					++ n;
+					sort_progress(i + 1, fileCnt);
 				}
-				if (!didSwap) break;
-			} //end of bubble sort loop
-#endif
-			  // Using RAM but not keeping names around
-			#if (SDSORT_USES_RAM && !SDSORT_CACHE_NAMES)
-			#if SDSORT_DYNAMIC_RAM
-			for (uint16_t i = 0; i < fileCnt; ++i) free(sortnames[i]);
-			#if HAS_FOLDER_SORTING
-			free(isDir);
-			#endif
-			#endif
-			#endif
-		}
-		else {
-			sort_order[0] = 0;
-		#if (SDSORT_USES_RAM && SDSORT_CACHE_NAMES)
-			getfilename(0);
-			#if SDSORT_DYNAMIC_RAM
-			sortnames = new char*[1];
-			sortnames[0] = strdup(LONGEST_FILENAME); // malloc
-			sortshort = new char*[1];
-			sortshort[0] = strdup(filename);         // malloc
-			isDir = new uint8_t[1];
-			#else
-			strcpy(sortnames[0], LONGEST_FILENAME);
-			strcpy(sortshort[0], filename);
-			#endif
-			isDir[0] = filenameIsDir ? 0x01 : 0x00;
-		#endif
-		}
+				stored = indexed && presort_store(slot + sizeof(header), order, n);
+			}
 
-		sort_count = fileCnt;
-	}
-#if !SDSORT_USES_RAM //show progresss bar only if slow sorting method is used
-	for (int column = 0; column <= 19; column++)
-	{
-		lcd_set_cursor(column, 2);
-		lcd_print('\x01'); //simple progress bar
+			// The header goes last, an interrupted update leaves the old checksum invalid.
+			header.dirCluster = workDir.firstCluster();
+			header.checksum = sort_checksum;
+			header.count = n;
+			header.sdSort = sdSort;
+			header.version = SORT_INDEX_VERSION;
+			if (stored && sort_index.seekSet(slot) && sort_index.write(&header, sizeof(header)) == sizeof(header) && sort_index.sync())
+				sort_count = n;
+			else
+				presort_ram(order, n);
+
+			_delay(300);
+			lcd_set_degree();
+			lcd_clear();
+		}
 	}
-	_delay(300);
-	lcd_set_degree();
-	lcd_clear();
-#endif
 	lcd_update(2);
 	KEEPALIVE_STATE(NOT_BUSY);
 	lcd_timeoutToStatus.start();
 }
 
 void CardReader::flush_presort() {
-	if (sort_count > 0) {
-		#if SDSORT_DYNAMIC_RAM
-		delete sort_order;
-		#if SDSORT_CACHE_NAMES
-		for (uint8_t i = 0; i < sort_count; ++i) {
-			free(sortshort[i]); // strdup
-			free(sortnames[i]); // strdup
-		}
-		delete sortshort;
-		delete sortnames;
-		#endif
-		#endif
-		sort_count = 0;
-	}
+	sort_count = 0;
+	sort_in_ram = false;
 }
 
 #endif // SDCARD_SORT_ALPHA
@@ -7,6 +7,19 @@
 
 #include "SdFile.h"
 enum LsAction {LS_SerialPrint,LS_Count,LS_GetFilename};
+
+#if SDCARD_NAME_CACHE_BYTES > 0
+//! Names of an item of the current directory, see CardReader::getfilename_cached()
+typedef struct
+{
+  uint16_t nr;    // Index of the item, NAME_CACHE_SORTED set if sorted, NAME_CACHE_EMPTY for an unused entry
+  uint8_t age;    // 0 for the most recently used entry
+  bool isDir;
+  char filename[13];
+  char longFilename[LONG_FILENAME_LENGTH];
+} name_cache_t;
+#define SD_NAME_CACHE_SIZE (SDCARD_NAME_CACHE_BYTES / sizeof(name_cache_t))
+#endif
 class CardReader
 {
 public:
@@ -33,6 +46,11 @@ public:
   void getfilename(uint16_t nr, const char* const match=NULL);
   void getfilename_simple(uint32_t position, const char * const match = NULL);
   uint16_t getnrfilenames();
+  //! getfilename() or getfilename_sorted() of an item shown in the SD menu, served from RAM if shown recently.
+  void getfilename_cached(uint16_t nr, bool sorted);
+  //! getnrfilenames() remembered until the current directory changes.
+  uint16_t getnrfilenames_cached();
+  void flush_name_cache();
   
   void getAbsFilename(char *t);
   void getDirName(char* name, uint8_t level);
@@ -61,6 +79,16 @@ public:
   FORCE_INLINE bool isFileOpen() { return file.isOpen(); }
   FORCE_INLINE bool eof() { return sdpos>=filesize ;};
   FORCE_INLINE int16_t get() {  sdpos = file.curPosition();return (int16_t)file.read();};
+  //! Bulk counterpart of get(): read at most nbyte bytes, up to the end of the current SD block, so that the block is read
+  //! from the volume cache once. sdpos points to the first byte read. Return the unused bytes by ungetChunk().
+  FORCE_INLINE int16_t getChunk(char *buf, uint16_t nbyte) { sdpos = file.curPosition(); uint16_t left = 512 - (sdpos & 0x1FF); if (nbyte > left) nbyte = left; return file.read(buf, nbyte); };
+  //! Keep the first used bytes of the n bytes returned by getChunk(). sdpos then points to the last byte used, like after get().
+  //! Seeking back within the block does not walk the FAT.
+  FORCE_INLINE void ungetChunk(uint16_t used, uint16_t n) { if (used < n) file.seekSet(sdpos + used); sdpos += used - 1; };
+#if SD_READ_AHEAD
+  //! Fetch the next block of the file being read in advance, see Sd2Card::readAhead().
+  FORCE_INLINE void readAhead() { card.readAhead(); };
+#endif
   FORCE_INLINE void setIndex(long index) {sdpos = index;file.seekSet(index);};
   FORCE_INLINE uint8_t percentDone(){if(!isFileOpen()) return 0; if(filesize) return sdpos/((filesize+99)/100); else return 0;};
   FORCE_INLINE char* getWorkDirName(){workDir.getFilename(filename);return filename;};
@@ -89,48 +117,23 @@ private:
   // Sort files and folders alphabetically.
 #ifdef SDCARD_SORT_ALPHA
   uint16_t sort_count;        // Count of sorted items in the current directory
+  uint32_t sort_checksum;     // Checksum of the items of the current directory, calculated by getnrfilenames()
+  SdFile sort_index;          // Sort order of the recently visited directories, see presort()
+  uint8_t sort_order[SDSORT_LIMIT]; // Directory indices of the sorted items, if the sort index cannot be written
+  bool sort_in_ram;           // The sort order is held in sort_order
   #if SDSORT_GCODE
   bool sort_alpha;          // Flag to enable / disable the feature
   int sort_folders;         // Flag to enable / disable folder sorting
 							//bool sort_reverse;      // Flag to enable / disable reverse sorting
   #endif
 
-							// By default the sort index is static
-  #if SDSORT_DYNAMIC_RAM
-  uint8_t *sort_order;
-  #else
-  uint8_t sort_order[SDSORT_LIMIT];
-  #endif
-  // Cache filenames to speed up SD menus.
-  #if SDSORT_USES_RAM
-
-  // If using dynamic ram for names, allocate on the heap.
-  #if SDSORT_CACHE_NAMES
-    #if SDSORT_DYNAMIC_RAM
-      char **sortshort, **sortnames;
-    #else
-      char sortshort[SDSORT_LIMIT][FILENAME_LENGTH];
-      char sortnames[SDSORT_LIMIT][FILENAME_LENGTH];
-    #endif
-  #elif !SDSORT_USES_STACK
-    char sortnames[SDSORT_LIMIT][FILENAME_LENGTH];
-    uint16_t modification_time[SDSORT_LIMIT];
-    uint16_t modification_date[SDSORT_LIMIT];
-  #endif
-
-  // Folder sorting uses an isDir array when caching items.
-  #if HAS_FOLDER_SORTING
-    #if SDSORT_DYNAMIC_RAM
-      uint8_t *isDir;
-    #elif (SDSORT_CACHE_NAMES) || !(SDSORT_USES_STACK)
-      uint8_t isDir[(SDSORT_LIMIT + 7) >> 3];
-    #endif
-  #endif
-
-  #endif // SDSORT_USES_RAM
-
 #endif // SDCARD_SORT_ALPHA
 
+#if SDCARD_NAME_CACHE_BYTES > 0
+  name_cache_t name_cache[SD_NAME_CACHE_SIZE];
+  uint16_t name_cache_count;  // getnrfilenames() of the current directory, NAME_CACHE_EMPTY if not known
+#endif
+
 #ifdef DEBUG_SD_SPEED_TEST
 public:
 #endif //DEBUG_SD_SPEED_TEST
@@ -159,6 +162,14 @@ private:
   void lsDive(const char *prepend, SdFile parent, const char * const match=NULL);
 #ifdef SDCARD_SORT_ALPHA
   void flush_presort();
+  bool sort_index_open();
+  uint32_t sort_index_slot();
+  bool sort_after(const char *name1, uint16_t date1, uint16_t time1, bool dir1, uint8_t sdSort);
+  void sort_key_load(struct sort_key_t &k, uint8_t sdSort);
+  bool sort_key_after(const struct sort_key_t &a, const struct sort_key_t &b, uint8_t sdSort);
+  bool presort_store(uint32_t offset, const uint16_t *order, uint16_t n);
+  bool presort_merge(uint32_t offset, uint16_t *order, uint16_t n, uint8_t sdSort);
+  void presort_ram(const uint16_t *order, uint16_t n);
 #endif
 };
 extern bool Stopped;
@@ -31,12 +31,118 @@ long Stopped_gcode_LastN = 0;
 
 uint32_t sdpos_atomic = 0;
 
+uint8_t code_index[26];
+bool code_index_valid = false;
+
+bool cmdqueue_windowed_ok = false;
+bool cmdqueue_resend_requested = false;
+
+#ifdef BINARY_GCODE
+bool binary_gcode_enabled = false;
+// The decoded commands are stored outside of cmdbuffer, as the binary values are not a zero terminated string.
+// These are the binary packets (entries of type CMDBUFFER_CURRENT_TYPE_BINARY) and the G0 / G1 moves
+// parsed while enqueued (GCODE_FAST_PATH). A slot is bound to its cmdbuffer entry by the entry position
+// and released when the entry is popped.
+static binary_gcode_packet_t binary_queue[BINARY_GCODE_QUEUE_SIZE];
+static uint16_t binary_queue_entry[BINARY_GCODE_QUEUE_SIZE];
+// Bit mask of the occupied slots.
+static uint8_t binary_queue_used = 0;
+static binary_gcode_decoder_t binary_decoder;
+static_assert(BINARY_GCODE_QUEUE_SIZE <= 8, "binary_queue_used is a byte mask");
+
+// Index of a free slot of binary_queue, BINARY_GCODE_QUEUE_SIZE if full.
+static uint8_t cmdqueue_binary_free_slot()
+{
+    uint8_t slot = 0;
+    while (slot < BINARY_GCODE_QUEUE_SIZE && (binary_queue_used & (1 << slot)))
+        ++ slot;
+    return slot;
+}
+
+// Index of the slot bound to the cmdbuffer entry at the given position, BINARY_GCODE_QUEUE_SIZE if none.
+static uint8_t cmdqueue_binary_slot(size_t entry)
+{
+    uint8_t slot = 0;
+    while (slot < BINARY_GCODE_QUEUE_SIZE && ! ((binary_queue_used & (1 << slot)) && binary_queue_entry[slot] == entry))
+        ++ slot;
+    return slot;
+}
+
+// Bind a slot to the cmdbuffer entry being written at bufindw.
+static void cmdqueue_binary_bind(uint8_t slot)
+{
+    binary_queue_used |= 1 << slot;
+    binary_queue_entry[slot] = bufindw;
+}
+
+bool cmdqueue_binary_take(binary_gcode_packet_t &packet)
+{
+    const uint8_t slot = cmdqueue_binary_slot(bufindr);
+    if (slot == BINARY_GCODE_QUEUE_SIZE)
+        return false;
+    packet = binary_queue[slot];
+    binary_queue_used &= ~(1 << slot);
+    return true;
+}
+
+#ifdef GCODE_FAST_PATH
+// Parse a plain G0 / G1 into a free slot while its cmdbuffer entry is being written at bufindw,
+// so that the text parser is skipped when it is executed. Without a free slot the text is parsed as usual.
+static void cmdqueue_parse_move()
+{
+    const uint8_t slot = cmdqueue_binary_free_slot();
+    if (slot < BINARY_GCODE_QUEUE_SIZE && binary_gcode_parse_move(cmdbuffer + bufindw + CMDHDRSIZE, &binary_queue[slot]))
+        cmdqueue_binary_bind(slot);
+}
+#endif /* GCODE_FAST_PATH */
+#endif /* BINARY_GCODE */
+
+
+// Record the first occurrence of each of the letters 'A' to 'Z' in the current command in one pass,
+// so that the parameters are not searched for by scanning the command again and again.
+static void code_index_build()
+{
+    memset(code_index, 0, sizeof(code_index));
+    const char *cmd = CMDBUFFER_CURRENT_STRING;
+    for (uint8_t i = 0; cmd[i] != 0; ++ i) {
+        const uint8_t letter = uint8_t(cmd[i] - 'A');
+        if (letter < sizeof(code_index) && code_index[letter] == 0)
+            code_index[letter] = i + 1;
+    }
+    code_index_valid = true;
+}
+
+bool code_seen(char code)
+{
+    const uint8_t letter = uint8_t(code - 'A');
+    if (letter >= sizeof(code_index))
+        return (strchr_pointer = strchr(CMDBUFFER_CURRENT_STRING, code)) != NULL;
+    if (! code_index_valid)
+        code_index_build();
+    const uint8_t pos = code_index[letter];
+    strchr_pointer = pos ? CMDBUFFER_CURRENT_STRING + pos - 1 : NULL;
+    return pos != 0;
+}
+
+bool code_seen(const char *code)
+{
+    // The first match of the string cannot precede the first occurrence of its first letter.
+    if (! code_seen(code[0]))
+        return false;
+    return (strchr_pointer = strstr(strchr_pointer, code)) != NULL;
+}
 
 // Pop the currently processed command from the queue.
 // It is expected, that there is at least one command in the queue.
 bool cmdqueue_pop_front()
 {
+    code_index_valid = false;
     if (buflen > 0) {
+#ifdef BINARY_GCODE
+        const uint8_t slot = cmdqueue_binary_slot(bufindr);
+        if (slot < BINARY_GCODE_QUEUE_SIZE)
+            binary_queue_used &= ~(1 << slot);
+#endif /* BINARY_GCODE */
 #ifdef CMDBUFFER_DEBUG
         SERIAL_ECHOPGM("Dequeing ");
         SERIAL_ECHO(cmdbuffer+bufindr+CMDHDRSIZE);
@@ -91,9 +197,15 @@ bool cmdqueue_pop_front()
 
 void cmdqueue_reset()
 {
+    code_index_valid = false;
     bufindr = 0;
     bufindw = 0;
     buflen = 0;
+#ifdef BINARY_GCODE
+    binary_queue_used = 0;
+    binary_decoder.count = 0;
+    binary_decoder.length = 0;
+#endif /* BINARY_GCODE */
 
 	//commands are removed from command queue after process_command() function is finished
 	//reseting command queue and enqueing new commands during some (usually long running) command processing would cause that new commands are immediately removed from queue (or damaged)
@@ -106,6 +218,7 @@ void cmdqueue_reset()
 // len_asked does not contain the zero terminator size.
 static bool cmdqueue_could_enqueue_front(size_t len_asked)
 {
+    code_index_valid = false;
     // MAX_CMD_SIZE has to accommodate the zero terminator.
     if (len_asked >= MAX_CMD_SIZE)
         return false;
@@ -368,6 +481,60 @@ bool is_buffer_empty()
     else return false;
 }
 
+// How many commands of the maximum length could still be pushed to the back of the queue?
+// Reported to the host by the windowed flow control.
+uint8_t cmdqueue_free_slots()
+{
+    if (bufindr == bufindw && buflen > 0)
+        // Full buffer.
+        return 0;
+    const size_t slot = MAX_CMD_SIZE + CMDHDRSIZE;
+    // A command does not wrap around, count the free space at the end and at the start separately.
+    size_t end, start;
+    if (bufindw < bufindr) {
+        end = bufindr - bufindw;
+        start = 0;
+    } else {
+        end = sizeof(cmdbuffer) - bufindw;
+        start = bufindr;
+    }
+    // Leave CMDBUFFER_RESERVE_FRONT for the chained commands.
+    size_t reserve = CMDBUFFER_RESERVE_FRONT;
+    if (start >= reserve) {
+        start -= reserve;
+    } else {
+        reserve -= start;
+        start = 0;
+        end = (end > reserve) ? end - reserve : 0;
+    }
+    uint8_t slots = end / slot + start / slot;
+    if (serial_count > 0 && slots > 0)
+        // A partially received line occupies the first slot.
+        -- slots;
+#ifdef BINARY_GCODE
+    if (binary_gcode_enabled) {
+        // The binary packets are limited by the slots of their queue as well.
+        uint8_t binary_slots = 0;
+        for (uint8_t i = 0; i < BINARY_GCODE_QUEUE_SIZE; ++ i)
+            if (! (binary_queue_used & (1 << i)))
+                ++ binary_slots;
+        if (binary_slots < slots)
+            slots = binary_slots;
+    }
+#endif /* BINARY_GCODE */
+    return slots;
+}
+
+// Line number of the command to be executed right now, -1 if it was not numbered.
+long cmdqueue_current_line()
+{
+    if (CMDBUFFER_CURRENT_TYPE != CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR && CMDBUFFER_CURRENT_TYPE != CMDBUFFER_CURRENT_TYPE_BINARY)
+        return -1;
+    const uint16_t n = uint8_t(cmdbuffer[bufindr+1]) | (uint16_t(uint8_t(cmdbuffer[bufindr+2])) << 8);
+    // Less than 64k lines are queued, extend the stored lower bits by the last received line number.
+    return gcode_LastN - uint16_t(uint16_t(gcode_LastN) - n);
+}
+
 void proc_commands() {
 	if (buflen)
 	{
@@ -378,11 +545,81 @@ void proc_commands() {
 	}
 }
 
+#ifdef BINARY_GCODE
+// Report a malformed serial line or packet and ask the host to resend it.
+static void get_command_resend(const char *msg)
+{
+    SERIAL_ERROR_START;
+    SERIAL_ERRORRPGM(msg);
+    SERIAL_ERRORLN(gcode_LastN);
+    FlushSerialRequestResend();
+    serial_count = 0;
+}
+
+// Feed a byte of a binary packet to the decoder. A complete packet is validated like a numbered text line
+// and stored into the queue with its cmdbuffer entry, which get_command() has already reserved.
+// Returns false if get_command() shall stop reading the serial line.
+static bool get_binary_command(uint8_t c)
+{
+    const uint8_t slot = cmdqueue_binary_free_slot();
+    binary_gcode_packet_t &packet = binary_queue[slot];
+    const int8_t status = binary_gcode_feed(&binary_decoder, c, &packet);
+    if (status == BINARY_GCODE_BUSY)
+        return true;
+    if (status == BINARY_GCODE_ERR_CRC) {
+        get_command_resend(_n("checksum mismatch, Last Line: "));////MSG_ERR_CHECKSUM_MISMATCH
+        return false;
+    }
+    if (status != BINARY_GCODE_DONE) {
+        // Bad sync, type or length of the packet
+        get_command_resend(_n("Binary packet framing error, Last Line: "));////MSG_ERR_BINARY_FRAME
+        return false;
+    }
+    gcode_N = gcode_LastN + 1;
+    if (packet.line != uint16_t(gcode_N)) {
+        if (cmdqueue_windowed_ok && cmdqueue_resend_requested)
+            // A packet sent before the host received the resend request, drop it silently.
+            return false;
+        get_command_resend(_n("Line Number is not Last Line Number+1, Last Line: "));////MSG_ERR_LINE_NO
+        return false;
+    }
+    gcode_LastN = gcode_N;
+    cmdqueue_resend_requested = false;
+    if (packet.type == BINARY_GCODE_MOVE) {
+        if (! IS_SD_PRINTING) {
+            usb_printing_counter = 10;
+            is_usb_printing = true;
+        }
+        if (Stopped == true) {
+            SERIAL_ERRORLNRPGM(MSG_ERR_STOPPED);
+            LCD_MESSAGERPGM(_T(MSG_STOPPED));
+        }
+    }
+    cmdqueue_binary_bind(slot);
+    cmdbuffer[bufindw] = CMDBUFFER_CURRENT_TYPE_BINARY;
+    cmdbuffer[bufindw+1] = uint8_t(gcode_N);
+    cmdbuffer[bufindw+2] = uint8_t(gcode_N >> 8);
+    cmdbuffer[bufindw+CMDHDRSIZE] = '0' + slot;
+    cmdbuffer[bufindw+CMDHDRSIZE+1] = 0;
+    bufindw += 2 + CMDHDRSIZE;
+    if (bufindw == sizeof(cmdbuffer))
+        bufindw = 0;
+    ++ buflen;
+    return MYSERIAL.available() != 0 && cmdqueue_could_enqueue_back(MAX_CMD_SIZE-1, true);
+}
+#endif /* BINARY_GCODE */
+
 void get_command()
 {
     // Test and reserve space for the new command string.
-    if (! cmdqueue_could_enqueue_back(MAX_CMD_SIZE - 1, true))
+    if (! cmdqueue_could_enqueue_back(MAX_CMD_SIZE - 1, true)) {
+#if defined(SDSUPPORT) && SD_READ_AHEAD
+      // Use the time while the queue is full to fetch the next block of the file being printed.
+      if (card.sdprinting)
+        card.readAhead();
+#endif
       return;
+    }
 
 	if (MYSERIAL.available() == RX_BUFFER_SIZE - 1) { //compare number of chars buffered in rx buffer with rx buffer size
 		MYSERIAL.flush();
@@ -391,6 +628,11 @@ void get_command()
 
   // start of serial line processing loop
   while ((MYSERIAL.available() > 0 && !saved_printing) || (MYSERIAL.available() > 0 && isPrintPaused)) {  //is print is saved (crash detection or filament detection), dont process data from serial line
+#ifdef BINARY_GCODE
+    if (binary_gcode_enabled && cmdqueue_binary_free_slot() == BINARY_GCODE_QUEUE_SIZE)
+        // Wait until a binary packet is executed.
+        return;
+#endif /* BINARY_GCODE */
 	
     char serial_char = MYSERIAL.read();
 /*    if (selectedSerialPort == 1)
@@ -402,6 +644,16 @@ void get_command()
       TimeSent = _millis();
       TimeNow = _millis();
 
+#ifdef BINARY_GCODE
+    // A binary packet may start where a new text line would.
+    if (binary_gcode_enabled && serial_count == 0 && ! comment_mode &&
+        (binary_gcode_busy(&binary_decoder) || uint8_t(serial_char) == BINARY_GCODE_SYNC)) {
+        if (! get_binary_command(serial_char))
+            return;
+        continue;
+    }
+#endif /* BINARY_GCODE */
+
     if (serial_char < 0)
         // Ignore extended ASCII characters. These characters have no meaning in the G-code apart from the file names
         // and Marlin does not support such file names anyway.
@@ -432,6 +684,11 @@ void get_command()
 			  if(gcode_N != gcode_LastN+1 && (strstr_P(cmdbuffer+bufindw+CMDHDRSIZE, PSTR("M110")) == NULL) ) {
 				  // M110 - set current line number.
 				  // Line numbers not sent in succession.
+				  if (cmdqueue_windowed_ok && cmdqueue_resend_requested) {
+					  // A line sent before the host received the resend request, drop it silently.
+					  serial_count = 0;
+					  return;
+				  }
 				  SERIAL_ERROR_START;
 				  SERIAL_ERRORRPGM(_n("Line Number is not Last Line Number+1, Last Line: "));////MSG_ERR_LINE_NO
 				  SERIAL_ERRORLN(gcode_LastN);
@@ -472,6 +729,7 @@ void get_command()
 			  cmdbuffer[bufindw + CMDHDRSIZE] = '$';
 			  //if no errors, continue parsing
 			  gcode_LastN = gcode_N;
+			  cmdqueue_resend_requested = false;
 		}
         // if we don't receive 'N' but still see '*'
         if ((cmdbuffer[bufindw + CMDHDRSIZE] != 'N') && (cmdbuffer[bufindw + CMDHDRSIZE] != '$') && (strchr(cmdbuffer+bufindw+CMDHDRSIZE, '*') != NULL))
@@ -505,6 +763,12 @@ void get_command()
         // Store the current line into buffer, move to the next line.
 		// Store type of entry
         cmdbuffer[bufindw] = gcode_N ? CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR : CMDBUFFER_CURRENT_TYPE_USB;
+        // The SD card length is not used by the USB commands, store the lower 16 bits of the line number instead.
+        cmdbuffer[bufindw+1] = uint8_t(gcode_N);
+        cmdbuffer[bufindw+2] = uint8_t(gcode_N >> 8);
+#ifdef GCODE_FAST_PATH
+        cmdqueue_parse_move();
+#endif /* GCODE_FAST_PATH */
 #ifdef CMDBUFFER_DEBUG
         SERIAL_ECHO_START;
         SERIAL_ECHOPGM("Storing a command line to buffer: ");
@@ -574,13 +838,32 @@ void get_command()
   } sd_count;
   sd_count.value = 0;
   // Reads whole lines from the SD card. Never leaves a half-filled line in the cmdbuffer.
+  // The file is read in chunks up to the end of the current SD block straight into the line being assembled,
+  // which is then scanned for its end and stripped of the comments in place.
   while( !card.eof() && !stop_buffering) {
-    int16_t n=card.get();
-    char serial_char = (char)n;
-    if(serial_char == '\n' ||
-       serial_char == '\r' ||
-       ((serial_char == '#' || serial_char == ':') && comment_mode == false) ||
-       serial_count >= (MAX_CMD_SIZE - 1) || n==-1)
+    char *chunk = cmdbuffer + bufindw + CMDHDRSIZE + serial_count;
+    int16_t n = card.getChunk(chunk, MAX_CMD_SIZE - serial_count);
+    int16_t i = 0;
+    char serial_char = 0;
+    for (; i < n; ++ i) {
+      serial_char = chunk[i];
+      if(serial_char == '\n' ||
+         serial_char == '\r' ||
+         ((serial_char == '#' || serial_char == ':') && comment_mode == false) ||
+         serial_count >= (MAX_CMD_SIZE - 1))
+        break;
+      // The line is compacted towards its start, never overtaking the chunk being scanned.
+      if(serial_char == ';') comment_mode = true;
+      else if(!comment_mode) cmdbuffer[bufindw+CMDHDRSIZE+serial_count++] = serial_char;
+    }
+    if (i == n && n > 0) {
+      // The whole chunk belongs to the line, continue with the next SD block.
+      card.ungetChunk(n, n);
+      continue;
+    }
+    // End of the line, or the end of the file (n == 0) or a read error (n == -1) terminate the line as well.
+    if (n > 0)
+      card.ungetChunk(i + 1, n);
     {
       if(card.eof()){
         SERIAL_PROTOCOLLNRPGM(_n("Done printing file"));////MSG_FILE_PRINTED
@@ -626,6 +909,9 @@ void get_command()
       cmdbuffer[bufindw+1] = sd_count.lohi.lo;
       cmdbuffer[bufindw+2] = sd_count.lohi.hi;
       cmdbuffer[bufindw+serial_count+CMDHDRSIZE] = 0; //terminate string
+#ifdef GCODE_FAST_PATH
+      cmdqueue_parse_move();
+#endif /* GCODE_FAST_PATH */
       // Calculate the length before disabling the interrupts.
       uint8_t len = strlen(cmdbuffer+bufindw+CMDHDRSIZE) + (1 + CMDHDRSIZE);
 
@@ -654,13 +940,12 @@ void get_command()
       comment_mode = false; //for new command
       serial_count = 0; //clear buffer
       // The following line will reserve buffer space if available.
-      if (! cmdqueue_could_enqueue_back(MAX_CMD_SIZE-1, true))
+      if (! cmdqueue_could_enqueue_back(MAX_CMD_SIZE-1, true)) {
+#if SD_READ_AHEAD
+          card.readAhead();
+#endif
           return;
-    }
-    else
-    {
-      if(serial_char == ';') comment_mode = true;
-      else if(!comment_mode) cmdbuffer[bufindw+CMDHDRSIZE+serial_count++] = serial_char;
+      }
     }
   }
 
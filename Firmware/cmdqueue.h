@@ -3,6 +3,7 @@
 
 #include "Marlin.h"
 #include "language.h"
+#include "binary_gcode.h"
 
 
 // String circular buffer. Commands may be pushed to the buffer from both sides:
@@ -24,6 +25,15 @@
 #define CMDBUFFER_CURRENT_TYPE_TO_BE_REMOVED 5
 //Command in cmdbuffer was sent over USB and contains line number
 #define CMDBUFFER_CURRENT_TYPE_USB_WITH_LINENR 6
+// Command was sent over USB as a binary packet, which is stored in the binary command queue.
+#define CMDBUFFER_CURRENT_TYPE_BINARY 7
+
+#if defined(GCODE_FAST_PATH) && !defined(BINARY_GCODE)
+#error "GCODE_FAST_PATH stores the parsed moves in the queue of the binary commands, BINARY_GCODE is required."
+#endif
+#if defined(BINARY_GCODE) && defined(FILAMENT_RUNOUT_SUPPORT)
+#error "The moves executed from binary_gcode_packet_t do not implement the FILAMENT_RUNOUT_SUPPORT filament change."
+#endif
 
 // How much space to reserve for the chained commands
 // of type CMDBUFFER_CURRENT_TYPE_CHAINED,
@@ -72,9 +82,31 @@ extern bool is_buffer_empty();
 extern void get_command();
 extern uint16_t cmdqueue_calc_sd_length();
 
-// Return True if a character was found
-static inline bool    code_seen(char code) { return (strchr_pointer = strchr(CMDBUFFER_CURRENT_STRING, code)) != NULL; }
-static inline bool    code_seen(const char *code) { return (strchr_pointer = strstr(CMDBUFFER_CURRENT_STRING, code)) != NULL; }
+// Windowed flow control (M722): the ok reports the line number and the free space of the queues.
+extern bool cmdqueue_windowed_ok;
+// Set by FlushSerialRequestResend(), cleared by the arrival of the requested line.
+extern bool cmdqueue_resend_requested;
+extern uint8_t cmdqueue_free_slots();
+extern long cmdqueue_current_line();
+
+#ifdef BINARY_GCODE
+// Accept the binary packets on the serial line (M720).
+extern bool binary_gcode_enabled;
+// Copy the decoded binary packet of the command to be executed right now and release its slot.
+// Returns false if the command has to be parsed from its text.
+extern bool cmdqueue_binary_take(binary_gcode_packet_t &packet);
+#endif /* BINARY_GCODE */
+
+// Positions of the first occurrence of the letters 'A' to 'Z' in the current command, plus one, zero if missing.
+// Filled by a single pass over the command, when it is searched for the first time.
+extern uint8_t code_index[26];
+// Cleared whenever the current command changes.
+extern bool code_index_valid;
+
+// Return True if a character was found. The letters are looked up in code_index, other characters are searched for.
+extern bool code_seen(char code);
+// Return True if a string was found. Starts at the first occurrence of its first letter.
+extern bool code_seen(const char *code);
 static inline float   code_value()      { return strtod(strchr_pointer+1, NULL);}
 static inline long    code_value_long()    { return strtol(strchr_pointer+1, NULL, 10); }
 static inline int16_t code_value_short()   { return int16_t(strtol(strchr_pointer+1, NULL, 10)); };
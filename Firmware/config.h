@@ -7,6 +7,10 @@
 #define ADC_CHAN_CNT      7         //number of used channels)
 #define ADC_OVRSAMPL      16        //oversampling multiplier
 #define ADC_CALLBACK      adc_ready //callback function ()
+#define ADC_CYCLE_SLOTS   112       //conversion slots between the callbacks, two timer ticks each
+#define ADC_MEDIAN_MSK    0b0000000000000001 //channels converted 3 * ADC_OVRSAMPL times in a cycle, the median of the three sums is used (hotend)
+#define ADC_SLOW_MSK      0b0000001001011010 //channels converted ADC_OVRSAMPL / ADC_SLOW_DIV times in a cycle, updated every ADC_SLOW_DIV cycles (1, PINDA, voltages, ambient)
+#define ADC_SLOW_DIV      4
 
 //SWI2C configuration
 #define SWI2C
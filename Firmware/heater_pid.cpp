@@ -0,0 +1,127 @@
+//! @file
+//! @brief PID controller of the heaters, run by manage_heater() at every temperature measurement
+
+#include "heater_pid.h"
+
+void pid_set(pid_param_t *param, float kp, float ki, float kd, float k1, float integral_max, float output_max)
+{
+    param->kp = kp;
+    param->ki = ki;
+    param->kd = kd;
+    param->k1 = k1;
+    param->i_max = integral_max / ki;
+    param->output_max = output_max;
+}
+
+float pid_update(const pid_param_t *param, pid_state_t *state, float target, float input)
+{
+    const float error = target - input;
+    state->p_term = param->kp * error;
+    state->i_sum += error;
+    if (state->i_sum < 0)
+        state->i_sum = 0;
+    else if (state->i_sum > param->i_max)
+        state->i_sum = param->i_max;
+    state->i_term = param->ki * state->i_sum;
+    // digital filtration of the derivative term changes
+    state->d_term = (param->kd * (input - state->last)) * (1.f - param->k1) + (param->k1 * state->d_term);
+    state->last = input;
+    // subtraction due to "Derivative on Measurement" method (i.e. derivative of input instead derivative of error is used)
+    float output = state->p_term + state->i_term - state->d_term;
+    if (output > param->output_max) {
+        if (error > 0)
+            state->i_sum -= error; // conditional un-integration
+        output = param->output_max;
+    } else if (output < 0) {
+        if (error < 0)
+            state->i_sum -= error; // conditional un-integration
+        output = 0;
+    }
+    return output;
+}
+
+pid_gain_t pid_gain(float gain)
+{
+    pid_gain_t g = { 0, 0 };
+    if (! (gain > 0))
+        return g;
+    // Normalize to <0.5, 1) for the full 16 bits of the mantissa.
+    while (gain >= 1.f && g.shift < 30) {
+        gain *= 0.5f;
+        ++ g.shift;
+    }
+    while (gain < 0.5f && g.shift > -30) {
+        gain *= 2.f;
+        -- g.shift;
+    }
+    const uint32_t mantissa = uint32_t(gain * 65536.f + 0.5f);
+    g.mantissa = (mantissa > 0xFFFF) ? 0xFFFF : uint16_t(mantissa);
+    return g;
+}
+
+//! x * m / 65536 by two 16x16 bit multiplications.
+static inline int32_t mul_q16(int32_t x, uint16_t m)
+{
+    return int32_t(int16_t(x >> 16)) * m + int32_t((uint32_t(uint16_t(x)) * m) >> 16);
+}
+
+int32_t pid_mul(int32_t x, pid_gain_t gain)
+{
+    if (gain.shift > 0) {
+        // Keeps |x| below 2^30, the output is saturated long before.
+        const int32_t limit = 0x40000000L >> gain.shift;
+        if (x >= limit)
+            x = limit - 1;
+        else if (x <= -limit)
+            x = 1 - limit;
+        return mul_q16(x << gain.shift, gain.mantissa);
+    }
+    if (x >= 0x40000000L)
+        x = 0x3FFFFFFFL;
+    else if (x <= -0x40000000L)
+        x = -0x3FFFFFFFL;
+    return mul_q16(x, gain.mantissa) >> -gain.shift;
+}
+
+void pid_fixed_set(pid_fixed_param_t *param, float kp, float ki, float kd, float k1, float integral_max, float output_max)
+{
+    param->kp = pid_gain(kp);
+    param->ki = pid_gain(ki);
+    param->kd = pid_gain(kd * (1.f - k1));
+    param->k1 = pid_gain(k1);
+    const float i_max = integral_max / ki * 256.f;
+    param->i_max = (i_max < 1073741824.f) ? int32_t(i_max) : 0x40000000L;
+    param->output_max = int32_t(output_max * 256.f);
+}
+
+//! Error limit, 512 C. Keeps the integral sum and the products in range.
+#define PID_FIXED_ERROR_MAX (512L * 256)
+
+int16_t pid_fixed_update(const pid_fixed_param_t *param, pid_fixed_state_t *state, int32_t target, int32_t input)
+{
+    int32_t error = target - input;
+    if (error > PID_FIXED_ERROR_MAX)
+        error = PID_FIXED_ERROR_MAX;
+    else if (error < -PID_FIXED_ERROR_MAX)
+        error = -PID_FIXED_ERROR_MAX;
+    state->p_term = pid_mul(error, param->kp);
+    state->i_sum += error;
+    if (state->i_sum < 0)
+        state->i_sum = 0;
+    else if (state->i_sum > param->i_max)
+        state->i_sum = param->i_max;
+    state->i_term = pid_mul(state->i_sum, param->ki);
+    state->d_term = pid_mul(input - state->last, param->kd) + pid_mul(state->d_term, param->k1);
+    state->last = input;
+    int32_t output = state->p_term + state->i_term - state->d_term;
+    if (output > param->output_max) {
+        if (error > 0)
+            state->i_sum -= error; // conditional un-integration
+        output = param->output_max;
+    } else if (output < 0) {
+        if (error < 0)
+            state->i_sum -= error; // conditional un-integration
+        output = 0;
+    }
+    return int16_t(output >> 8);
+}
@@ -0,0 +1,94 @@
+//! @file
+//! @brief PID controller of the heaters, run by manage_heater() at every temperature measurement
+//!
+//! Two engines are provided, selected by FIXED_POINT_PID in manage_heater():
+//! pid_update() calculates in float, pid_fixed_update() in 32 bit integers with the temperatures
+//! and the terms scaled by 256 (Q8) and the gains converted to a 16 bit mantissa and a power of two.
+//! Both follow the same "Derivative on Measurement" law with the conditional un-integration on saturation:
+//!
+//!     i_sum = constrain(i_sum + error, 0, i_max)
+//!     d_term = kd * (input - last) * (1 - k1) + k1 * d_term
+//!     output = kp * error + ki * i_sum - d_term
+
+#ifndef HEATER_PID_H
+#define HEATER_PID_H
+
+#include <stdint.h>
+
+//! Parameters of the float engine.
+typedef struct
+{
+    float kp;
+    //! Scaled by PID_dT
+    float ki;
+    //! Scaled by 1 / PID_dT
+    float kd;
+    //! Smoothing factor of the derivative term
+    float k1;
+    //! Limit of the integral sum, the integral drive limit divided by ki
+    float i_max;
+    float output_max;
+} pid_param_t;
+
+typedef struct
+{
+    float i_sum;
+    float d_term;
+    //! Input of the previous cycle
+    float last;
+    float p_term;
+    float i_term;
+} pid_state_t;
+
+void pid_set(pid_param_t *param, float kp, float ki, float kd, float k1, float integral_max, float output_max);
+
+//! @return output between 0 and param->output_max
+float pid_update(const pid_param_t *param, pid_state_t *state, float target, float input);
+
+//! Gain of the fixed point engine, mantissa * 2^shift / 65536.
+typedef struct
+{
+    uint16_t mantissa;
+    int8_t shift;
+} pid_gain_t;
+
+pid_gain_t pid_gain(float gain);
+
+//! @return x * gain, rounded down
+int32_t pid_mul(int32_t x, pid_gain_t gain);
+
+//! Conversion of a temperature to the fixed point engine.
+#define PID_FIXED(temperature) ((int32_t)((temperature) * 256.f + 0.5f))
+
+//! Parameters of the fixed point engine.
+typedef struct
+{
+    pid_gain_t kp;
+    pid_gain_t ki;
+    //! kd * (1 - k1)
+    pid_gain_t kd;
+    pid_gain_t k1;
+    //! Q8
+    int32_t i_max;
+    //! Q8
+    int32_t output_max;
+} pid_fixed_param_t;
+
+//! All Q8
+typedef struct
+{
+    int32_t i_sum;
+    int32_t d_term;
+    int32_t last;
+    int32_t p_term;
+    int32_t i_term;
+} pid_fixed_state_t;
+
+void pid_fixed_set(pid_fixed_param_t *param, float kp, float ki, float kd, float k1, float integral_max, float output_max);
+
+//! @param target PID_FIXED() of the target temperature
+//! @param input PID_FIXED() of the measured temperature
+//! @return output between 0 and output_max, in the units of output_max
+int16_t pid_fixed_update(const pid_fixed_param_t *param, pid_fixed_state_t *state, int32_t target, int32_t input);
+
+#endif /* HEATER_PID_H */
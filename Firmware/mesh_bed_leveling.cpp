@@ -13,6 +13,45 @@ void mesh_bed_leveling::reset() {
     for (int y = 0; y < MESH_NUM_Y_POINTS; y++)
         for (int x = 0; x < MESH_NUM_X_POINTS; x++)
             z_values[y][x] = 0;
+    invalidate_cell();
+}
+
+// Parameters of the crossings of a 1D move from p by dp with the inner mesh lines, in the order of travel.
+static uint8_t mesh_line_crossings(float p, float dp, float p_min, float p_dist, uint8_t n_points, float *t)
+{
+    uint8_t n = 0;
+    if (dp == 0.f)
+        return 0;
+    const float dp_inv = 1.f / dp;
+    for (uint8_t k = 1; k + 1 < n_points; ++ k) {
+        float tk = (p_min + p_dist * k - p) * dp_inv;
+        if (tk > 0.f && tk < 1.f)
+            t[n ++] = tk;
+    }
+    if (dp < 0.f && n > 1)
+        // The lines were visited against the direction of travel.
+        for (uint8_t i = 0, j = n - 1; i < j; ++ i, -- j) {
+            float tmp = t[i];
+            t[i] = t[j];
+            t[j] = tmp;
+        }
+    return n;
+}
+
+uint8_t mesh_bed_leveling::get_crossings(float x, float y, float dx, float dy, float *t)
+{
+    float tx[MESH_NUM_X_POINTS - 2];
+    float ty[MESH_NUM_Y_POINTS - 2];
+    uint8_t nx = mesh_line_crossings(x, dx, MESH_MIN_X, MESH_X_DIST, MESH_NUM_X_POINTS, tx);
+    uint8_t ny = mesh_line_crossings(y, dy, MESH_MIN_Y, MESH_Y_DIST, MESH_NUM_Y_POINTS, ty);
+    // Merge the two ascending sequences, drop the duplicates of a move passing through a mesh node.
+    uint8_t n = 0;
+    for (uint8_t ix = 0, iy = 0; ix < nx || iy < ny;) {
+        float tn = (iy == ny || (ix < nx && tx[ix] < ty[iy])) ? tx[ix ++] : ty[iy ++];
+        if (n == 0 || tn - t[n - 1] > 1e-4f)
+            t[n ++] = tn;
+    }
+    return n;
 }
 
 static inline bool vec_undef(const float v[2])
@@ -84,6 +123,7 @@ void mesh_bed_leveling::upsample_3x3()
             }
         }
     }
+    invalidate_cell();
 
 /*
     // Relax the non-measured points.
@@ -29,8 +29,17 @@ public:
     // Otherwise a correction matrix is pulled from the EEPROM if available.
     static void get_meas_xy(int ix, int iy, float &x, float &y, bool use_default);
     
-    void set_z(int ix, int iy, float z) { z_values[iy][ix] = z; }
+    void set_z(int ix, int iy, float z) { z_values[iy][ix] = z; invalidate_cell(); }
     
+    // Maximum number of mesh lines crossed by a single move.
+    static const uint8_t max_crossings = (MESH_NUM_X_POINTS - 2) + (MESH_NUM_Y_POINTS - 2);
+
+    // Split the move from (x, y) by (dx, dy) at the inner mesh lines. Fills t[max_crossings] with the ascending
+    // parameters of the crossings inside (0, 1) and returns their count. Each segment stays inside a single cell,
+    // where the Z correction is bilinear. It is linear along the segments parallel to an axis, otherwise the twist
+    // d = z11 - z10 - z01 + z00 of the cell makes it quadratic and it deviates from the chord by up to |d| / 4.
+    static uint8_t get_crossings(float x, float y, float dx, float dy, float *t);
+
     int select_x_index(float x) {
         int i = 1;
         while (x > get_x(i) && i < MESH_NUM_X_POINTS - 1) i++;
@@ -73,51 +82,53 @@ public:
                 t = 0;
         }
 #else
-        i = int(floor((x - MESH_MIN_X) / MESH_X_DIST));
-        if (i < 0) {
+        // O(1) cell lookup: the integer part of the scaled coordinate is the cell index, the fraction is the position
+        // inside the cell. Outside of the mesh, the border cells are extrapolated.
+        float u = (x - MESH_MIN_X) * (1.f / MESH_X_DIST);
+        if (u < 0)
             i = 0;
-            s = (x - MESH_MIN_X) / MESH_X_DIST;
-            if (s > 1.f)
-                s = 1.f;
-        }
-        else if (i > MESH_NUM_X_POINTS - 2) {
+        else if (u >= MESH_NUM_X_POINTS - 2)
             i = MESH_NUM_X_POINTS - 2;
-            s = (x - get_x(i)) / MESH_X_DIST;
-            if (s < 0)
-                s = 0;
-        } else {
-            s = (x - get_x(i)) / MESH_X_DIST;
-            if (s < 0)
-                s = 0;
-            else if (s > 1.f)
-                s = 1.f;
-        }
-        j = int(floor((y - MESH_MIN_Y) / MESH_Y_DIST));
-        if (j < 0) {
+        else
+            i = int(u);
+        s = u - i;
+        float v = (y - MESH_MIN_Y) * (1.f / MESH_Y_DIST);
+        if (v < 0)
             j = 0;
-            t = (y - MESH_MIN_Y) / MESH_Y_DIST;
-            if (t > 1.f)
-                t = 1.f;
-        } else if (j > MESH_NUM_Y_POINTS - 2) {
+        else if (v >= MESH_NUM_Y_POINTS - 2)
             j = MESH_NUM_Y_POINTS - 2;
-            t = (y - get_y(j)) / MESH_Y_DIST;
-            if (t < 0)
-                t = 0;
-        } else {
-            t = (y - get_y(j)) / MESH_Y_DIST;
-            if (t < 0)
-                t = 0;
-            else if (t > 1.f)
-                t = 1.f;
-        }
+        else
+            j = int(v);
+        t = v - j;
 #endif /* MESH_NUM_X_POINTS==3 && MESH_NUM_Y_POINTS==3 */
         
-        float si = 1.f-s;
-        float z0 = si * z_values[j  ][i] + s * z_values[j  ][i+1];
-        float z1 = si * z_values[j+1][i] + s * z_values[j+1][i+1];
-        return (1.f-t) * z0 + t * z1;
+        if (i != cell_i || j != cell_j) {
+            // Bilinear coefficients of the cell, reused while the moves stay inside the cell.
+            const float z00 = z_values[j  ][i];
+            const float z10 = z_values[j  ][i+1];
+            const float z01 = z_values[j+1][i];
+            const float z11 = z_values[j+1][i+1];
+            cell_a = z00;
+            cell_b = z10 - z00;
+            cell_c = z01 - z00;
+            cell_d = z11 - z10 - z01 + z00;
+            cell_i = i;
+            cell_j = j;
+        }
+        return cell_a + cell_b * s + (cell_c + cell_d * s) * t;
     }
     
+    // Drop the cached cell coefficients. To be called after z_values are modified directly.
+    void invalidate_cell() { cell_i = -1; }
+
+private:
+    // Cell of the last get_z() call and its bilinear coefficients z = a + b*s + (c + d*s)*t, s, t in <0, 1>.
+    int8_t cell_i;
+    int8_t cell_j;
+    float  cell_a;
+    float  cell_b;
+    float  cell_c;
+    float  cell_d;
 };
 
 extern mesh_bed_leveling mbl;
@@ -23,8 +23,25 @@
 #include "stepper.h"
 #include "planner.h"
 
+// Length of the arc segments [mm] for an arc of the given radius [mm] traced at the given feedrate [mm/s].
+// The chord of a segment deviates from the arc by at most ARC_TOLERANCE: sagitta = r - sqrt(r^2 - (chord/2)^2),
+// chord ~ sqrt(8 * r * ARC_TOLERANCE). The segments are made longer at high feedrates to keep the segment rate
+// below ARC_SEGMENTS_PER_SEC, which the planner is able to digest without starving the stepper.
+static float mc_arc_segment_length(float radius, float feed_rate)
+{
+  float mm_per_segment = sqrt(8.f * ARC_TOLERANCE * radius);
+  float mm_per_segment_min = feed_rate * (1.f / ARC_SEGMENTS_PER_SEC);
+  if (mm_per_segment < mm_per_segment_min)
+    mm_per_segment = mm_per_segment_min;
+  if (mm_per_segment < MIN_MM_PER_ARC_SEGMENT)
+    mm_per_segment = MIN_MM_PER_ARC_SEGMENT;
+  else if (mm_per_segment > MM_PER_ARC_SEGMENT)
+    mm_per_segment = MM_PER_ARC_SEGMENT;
+  return mm_per_segment;
+}
+
 // The arc is approximated by generating a huge number of tiny, linear segments. The length of each 
-// segment is configured in settings.mm_per_arc_segment.  
+// segment is adapted to the radius and the feedrate by mc_arc_segment_length().
 void mc_arc(float *position, float *target, float *offset, uint8_t axis_0, uint8_t axis_1, 
   uint8_t axis_linear, float feed_rate, float radius, uint8_t isclockwise, uint8_t extruder)
 {      
@@ -54,7 +71,7 @@ void mc_arc(float *position, float *target, float *offset, uint8_t axis_0, uint8
   
   float millimeters_of_travel = hypot(angular_travel*radius, fabs(linear_travel));
   if (millimeters_of_travel < 0.001) { return; }
-  uint16_t segments = floor(millimeters_of_travel/MM_PER_ARC_SEGMENT);
+  uint16_t segments = floor(millimeters_of_travel/mc_arc_segment_length(radius, feed_rate));
   if(segments == 0) segments = 1;
   
   /*  
@@ -58,6 +58,8 @@
 #include "ultralcd.h"
 #include "language.h"
 #include "ConfigurationStore.h"
+#include "cardreader.h"
+#include "trapezoid.h"
 
 #ifdef MESH_BED_LEVELING
 #include "mesh_bed_leveling.h"
@@ -112,10 +114,27 @@ unsigned char g_uc_extruder_last_move[3] = {0,0,0};
 block_t block_buffer[BLOCK_BUFFER_SIZE];            // A ring buffer for motion instfructions
 volatile unsigned char block_buffer_head;           // Index of the next block to be pushed
 volatile unsigned char block_buffer_tail;           // Index of the block to process now
+// Index of the last block, which entry speed is optimal together with the entry speeds of all the blocks before it.
+// The entry speeds of these blocks will not change by adding new blocks, planner_recalculate() starts here.
+static unsigned char block_buffer_planned;
+
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+// Cross section of the filament [mm^2]
+#define FILAMENT_AREA (M_PI / 4 * DEFAULT_NOMINAL_FILAMENT_DIA * DEFAULT_NOMINAL_FILAMENT_DIA)
+// Sums over the blocks from extrusion_tail to block_buffer_head, see planner_extrusion_rate().
+// A block is added by plan_buffer_line() and subtracted after the stepper interrupt has discarded it.
+static unsigned char extrusion_tail;
+static uint32_t extrusion_e_steps;  // E steps of the forward extrusions
+static float extrusion_duration;    // Nominal duration of the blocks [s]
+#endif /* PID_EXTRUSION_RATE_FEED_FORWARD */
 
 #ifdef PLANNER_DIAGNOSTICS
 // Diagnostic function: Minimum number of planned moves since the last 
 static uint8_t g_cntr_planner_queue_min = 0;
+planner_stats_t planner_stats;
+volatile uint16_t planner_queue_empty_ms = 0;
+// Set while the queue is drained on purpose, cleared by the next block.
+static bool g_planner_drain_expected = true;
 #endif /* PLANNER_DIAGNOSTICS */
 
 //===========================================================================
@@ -204,63 +223,10 @@ void calculate_trapezoid_for_block(block_t *block, float entry_speed, float exit
   if (final_rate > block->nominal_rate)
       final_rate = block->nominal_rate;
 
-  uint32_t acceleration      = block->acceleration_st;
-  if (acceleration == 0)
-      // Don't allow zero acceleration.
-      acceleration = 1;
-  // estimate_acceleration_distance(float initial_rate, float target_rate, float acceleration)
-  // (target_rate*target_rate-initial_rate*initial_rate)/(2.0*acceleration));
-  uint32_t initial_rate_sqr  = initial_rate*initial_rate;
-  //FIXME assert that this result fits a 64bit unsigned int.
-  uint32_t nominal_rate_sqr  = block->nominal_rate*block->nominal_rate;
-  uint32_t final_rate_sqr    = final_rate*final_rate;
-  uint32_t acceleration_x2   = acceleration << 1;
-  // ceil(estimate_acceleration_distance(initial_rate, block->nominal_rate, acceleration));
-  uint32_t accelerate_steps  = (nominal_rate_sqr - initial_rate_sqr + acceleration_x2 - 1) / acceleration_x2;
-  // floor(estimate_acceleration_distance(block->nominal_rate, final_rate, -acceleration));
-  uint32_t decelerate_steps  = (nominal_rate_sqr - final_rate_sqr) / acceleration_x2;
-  uint32_t accel_decel_steps = accelerate_steps + decelerate_steps;
-  // Size of Plateau of Nominal Rate.
-  uint32_t plateau_steps     = 0;
-
-  // Is the Plateau of Nominal Rate smaller than nothing? That means no cruising, and we will
-  // have to use intersection_distance() to calculate when to abort acceleration and start braking
-  // in order to reach the final_rate exactly at the end of this block.
-  if (accel_decel_steps < block->step_event_count.wide) {
-    plateau_steps = block->step_event_count.wide - accel_decel_steps;
-  } else {
-    uint32_t acceleration_x4  = acceleration << 2;
-    // Avoid negative numbers
-    if (final_rate_sqr >= initial_rate_sqr) {
-        // accelerate_steps = ceil(intersection_distance(initial_rate, final_rate, acceleration, block->step_event_count));
-        // intersection_distance(float initial_rate, float final_rate, float acceleration, float distance) 
-        // (2.0*acceleration*distance-initial_rate*initial_rate+final_rate*final_rate)/(4.0*acceleration);
-#if 0
-        accelerate_steps = (block->step_event_count >> 1) + (final_rate_sqr - initial_rate_sqr + acceleration_x4 - 1 + (block->step_event_count & 1) * acceleration_x2) / acceleration_x4;
-#else
-        accelerate_steps = final_rate_sqr - initial_rate_sqr + acceleration_x4 - 1;
-        if (block->step_event_count.wide & 1)
-            accelerate_steps += acceleration_x2;
-        accelerate_steps /= acceleration_x4;
-        accelerate_steps += (block->step_event_count.wide >> 1);
-#endif
-        if (accelerate_steps > block->step_event_count.wide)
-            accelerate_steps = block->step_event_count.wide;
-    } else {
-#if 0
-        decelerate_steps = (block->step_event_count >> 1) + (initial_rate_sqr - final_rate_sqr + (block->step_event_count & 1) * acceleration_x2) / acceleration_x4;
-#else
-        decelerate_steps = initial_rate_sqr - final_rate_sqr;
-        if (block->step_event_count.wide & 1)
-            decelerate_steps += acceleration_x2;
-        decelerate_steps /= acceleration_x4;
-        decelerate_steps += (block->step_event_count.wide >> 1);
-#endif
-        if (decelerate_steps > block->step_event_count.wide)
-            decelerate_steps = block->step_event_count.wide;
-        accelerate_steps = block->step_event_count.wide - decelerate_steps;
-    }
-  }
+  uint32_t accelerate_steps;
+  uint32_t plateau_steps;
+  trapezoid_steps(initial_rate, final_rate, block->nominal_rate, block->acceleration_st,
+      block->step_event_count.wide, accelerate_steps, plateau_steps);
 
   CRITICAL_SECTION_START;  // Fill variables used by the stepper in a critical section
   // This block locks the interrupts globally for 4.38 us,
@@ -301,6 +267,12 @@ FORCE_INLINE float max_allowable_entry_speed(float decceleration, float target_v
 //
 //   3. Recalculate trapezoids for all blocks.
 //
+// The blocks up to block_buffer_planned are skipped. An entry speed is optimal, if it reached
+// the maximum junction speed, or if it is limited by the acceleration from an optimal previous block.
+// Adding a new block may only raise the reverse pass limits as long as the exit speed of the previous
+// last block does not drop, therefore such entry speeds will not change anymore. If the exit speed drops,
+// plan_buffer_line() resets block_buffer_planned and the whole queue is replanned.
+//
 //FIXME This routine is called 15x every time a new line is added to the planner,
 // therefore it is a bottle neck and it shall be rewritten into a Fixed Point arithmetics,
 // if the CPU is found lacking computational power.
@@ -332,8 +304,14 @@ void planner_recalculate(const float &safe_final_speed)
 
 //    SERIAL_ECHOLNPGM("planner_recalculate - 1");
 
-    // At least three blocks are in the queue?
     unsigned char n_blocks = (block_buffer_head + BLOCK_BUFFER_SIZE - tail) & (BLOCK_BUFFER_SIZE - 1);
+    // Start at the last optimally planned block, if it has not been consumed by the stepper interrupt yet.
+    if (((block_buffer_planned + BLOCK_BUFFER_SIZE - tail) & (BLOCK_BUFFER_SIZE - 1)) < n_blocks) {
+        tail = block_buffer_planned;
+        n_blocks = (block_buffer_head + BLOCK_BUFFER_SIZE - tail) & (BLOCK_BUFFER_SIZE - 1);
+    }
+
+    // At least three blocks are in the queue?
     if (n_blocks >= 3) {
         // Initialize the last tripple of blocks.
         block_index = prev_block_index(block_buffer_head);
@@ -385,19 +363,29 @@ void planner_recalculate(const float &safe_final_speed)
         block_index = tail;
         prev    = block_buffer + block_index;
         current = block_buffer + (block_index = next_block_index(block_index));
+        // The saved tail is either the last optimal block or a block starting from a full halt.
+        block_buffer_planned = tail;
         do {
             // If the previous block is an acceleration block, but it is not long enough to complete the
             // full speed change within the block, we need to adjust the entry speed accordingly. Entry
             // speeds have already been reset, maximized, and reverse planned by reverse planner.
             // If nominal length is true, max junction speed is guaranteed to be reached. No need to recheck.
+            bool optimal = current->entry_speed == current->max_entry_speed;
             if (! (prev->flag & BLOCK_FLAG_NOMINAL_LENGTH) && prev->entry_speed < current->entry_speed) {
-                float entry_speed = min(current->entry_speed, max_allowable_entry_speed(-prev->acceleration,prev->entry_speed,prev->millimeters));
-                // Check for junction speed change
-                if (current->entry_speed != entry_speed) {
-                    current->entry_speed = entry_speed;
-                    current->flag |= BLOCK_FLAG_RECALCULATE;
+                float entry_speed = max_allowable_entry_speed(-prev->acceleration,prev->entry_speed,prev->millimeters);
+                if (entry_speed <= current->entry_speed) {
+                    // Limited by the acceleration from the previous block.
+                    optimal = true;
+                    // Check for junction speed change
+                    if (current->entry_speed != entry_speed) {
+                        current->entry_speed = entry_speed;
+                        current->flag |= BLOCK_FLAG_RECALCULATE;
+                    }
                 }
             }
+            // Extend the optimally planned part of the queue.
+            if (optimal && block_buffer_planned == prev_block_index(block_index))
+                block_buffer_planned = block_index;
             // Recalculate if current block entry or exit junction speed has changed.
             if ((prev->flag | current->flag) & BLOCK_FLAG_RECALCULATE) {
                 // NOTE: Entry and exit factors always > 0 by all previous logic operations.
@@ -423,9 +411,19 @@ void planner_recalculate(const float &safe_final_speed)
 void plan_init() {
   block_buffer_head = 0;
   block_buffer_tail = 0;
+  block_buffer_planned = 0;
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+  extrusion_tail = 0;
+  extrusion_e_steps = 0;
+  extrusion_duration = 0;
+#endif /* PID_EXTRUSION_RATE_FEED_FORWARD */
+#ifdef PLANNER_DIAGNOSTICS
+  planner_stats_reset();
+  g_planner_drain_expected = true;
+#endif /* PLANNER_DIAGNOSTICS */
   memset(position, 0, sizeof(position)); // clear position
 #ifdef LIN_ADVANCE
-  memset(position_float, 0, sizeof(position)); // clear position
+  memset(position_float, 0, sizeof(position_float)); // clear position
 #endif
   previous_speed[0] = 0.0;
   previous_speed[1] = 0.0;
@@ -580,6 +578,34 @@ static inline void planner_update_queue_min_counter()
   if (new_counter < g_cntr_planner_queue_min)
     g_cntr_planner_queue_min = new_counter;
 }
+
+// Sample the queue occupancy seen by a new block and collect the time the stepper spent without a block.
+static inline void planner_update_stats()
+{
+  CRITICAL_SECTION_START;
+  uint16_t empty_ms = planner_queue_empty_ms;
+  planner_queue_empty_ms = 0;
+  CRITICAL_SECTION_END;
+  if (g_planner_drain_expected || !(IS_SD_PRINTING || is_usb_printing)) {
+    // The first block after the queue has been drained on purpose starts the motion again, it is not counted.
+    // Neither is a move of an idle printer, e.g. a jog from the LCD or a host command outside of a print.
+    g_planner_drain_expected = false;
+    return;
+  }
+  uint8_t queued = moves_planned();
+  if (queued < planner_stats.queue_min)
+    planner_stats.queue_min = queued;
+  if (planner_stats.samples != 0xffff) {
+    planner_stats.queue_sum += queued;
+    ++ planner_stats.samples;
+  }
+  // The queue may only run dry once between two new blocks.
+  if (empty_ms != 0) {
+    if (planner_stats.underruns != 0xffff)
+      ++ planner_stats.underruns;
+    planner_stats.starved_ms += empty_ms;
+  }
+}
 #endif /* PLANNER_DIAGNOSTICS */
 
 extern volatile uint32_t step_events_completed; // The number of step events executed in the current block
@@ -588,6 +614,9 @@ void planner_abort_hard()
 {
     // Abort the stepper routine and flush the planner queue.
     DISABLE_STEPPER_DRIVER_INTERRUPT();
+#ifdef PLANNER_DIAGNOSTICS
+    g_planner_drain_expected = true;
+#endif /* PLANNER_DIAGNOSTICS */
 
     // Now the front-end (the Marlin_main.cpp with its current_position) is out of sync.
     // First update the planner's current position in the physical motor steps.
@@ -635,6 +664,7 @@ void planner_abort_hard()
 #endif
     // Clear the planner queue, reset and re-enable the stepper timer.
     quickStop();
+    block_buffer_planned = block_buffer_tail;
 
     // Apply inverse world correction matrix.
     machine2world(current_position[X_AXIS], current_position[Y_AXIS]);
@@ -651,6 +681,37 @@ void planner_abort_hard()
     waiting_inside_plan_buffer_line_print_aborted = true;
 }
 
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+// E steps of a block, which melt filament. Retractions do not.
+static inline uint32_t block_extrusion_steps(const block_t *block)
+{
+  return (block->direction_bits & (1 << E_AXIS)) ? 0 : block->steps_e.wide;
+}
+
+// Subtract the blocks discarded by the stepper interrupt from the sums.
+// Called before plan_buffer_line() reuses their slots.
+static void extrusion_discard()
+{
+  const unsigned char tail = block_buffer_tail;
+  for (; extrusion_tail != tail; extrusion_tail = next_block_index(extrusion_tail)) {
+    const block_t *block = &block_buffer[extrusion_tail];
+    extrusion_e_steps -= block_extrusion_steps(block);
+    extrusion_duration -= block->millimeters / block->nominal_speed;
+  }
+  // The rounding errors of the float sum do not accumulate past an empty queue.
+  if (tail == block_buffer_head)
+    extrusion_duration = 0;
+}
+
+float planner_extrusion_rate()
+{
+  extrusion_discard();
+  if (extrusion_duration <= 0)
+    return 0;
+  return extrusion_e_steps / cs.axis_steps_per_unit[E_AXIS] / extrusion_duration * FILAMENT_AREA;
+}
+#endif /* PID_EXTRUSION_RATE_FEED_FORWARD */
+
 void plan_buffer_line_curposXYZE(float feed_rate, uint8_t extruder) { 
 	plan_buffer_line(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS], feed_rate, extruder );
 }
@@ -685,7 +746,11 @@ void plan_buffer_line(float x, float y, float z, const float &e, float feed_rate
   }
 #ifdef PLANNER_DIAGNOSTICS
   planner_update_queue_min_counter();
+  planner_update_stats();
 #endif /* PLANNER_DIAGNOSTICS */
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+  extrusion_discard();
+#endif /* PID_EXTRUSION_RATE_FEED_FORWARD */
 
 #ifdef ENABLE_AUTO_BED_LEVELING
   apply_rotation_xyz(plan_bed_level_matrix, x, y, z);
@@ -851,8 +916,6 @@ block->steps_y.wide = labs((target[X_AXIS]-position[X_AXIS]) - (target[Y_AXIS]-p
     block->direction_bits |= (1<<E_AXIS); 
   }
 
-  block->active_extruder = extruder;
-
   //enable active axes
   #ifdef COREXY
   if((block->steps_x.wide != 0) || (block->steps_y.wide != 0))
@@ -971,7 +1034,7 @@ Having the real displacement of the head, we can calculate the total movement le
 #endif // SLOWDOWN
 
   block->nominal_speed = block->millimeters * inverse_second; // (mm/sec) Always > 0
-  block->nominal_rate = ceil(block->step_event_count.wide * inverse_second); // (step/sec) Always > 0
+  float nominal_rate = ceil(block->step_event_count.wide * inverse_second); // (step/sec) Always > 0
 
   // Calculate and limit speed in mm/sec for each axis
   float current_speed[4];
@@ -995,8 +1058,10 @@ Having the real displacement of the head, we can calculate the total movement le
       current_speed[i] *= speed_factor;
     }
     block->nominal_speed *= speed_factor;
-    block->nominal_rate *= speed_factor;
+    nominal_rate = (unsigned long)(nominal_rate * speed_factor);
   }
+  // The stepper interrupt does not step faster than MAX_STEP_FREQUENCY, block->nominal_rate is 16 bit.
+  block->nominal_rate = (nominal_rate > MAX_STEP_FREQUENCY) ? MAX_STEP_FREQUENCY : (uint16_t)nominal_rate;
 
   // Compute and limit the acceleration rate for the trapezoid generator.  
   // block->step_event_count ... event count of the fastest axis
@@ -1155,6 +1220,11 @@ Having the real displacement of the head, we can calculate the total movement le
   // Update previous path unit_vector and nominal speed
   memcpy(previous_speed, current_speed, sizeof(previous_speed)); // previous_speed[] = current_speed[]
   previous_nominal_speed = block->nominal_speed;
+  // The exit speed of the previous block dropped below the speed it was planned with,
+  // therefore the optimally planned entry speeds of the older blocks may need to be lowered.
+  // If the queue has drained, block_buffer_planned points to a consumed block.
+  if (block->entry_speed < previous_safe_speed || block_buffer_tail == block_buffer_head)
+    block_buffer_planned = block_buffer_tail;
   previous_safe_speed = safe_speed;
 
 #ifdef LIN_ADVANCE
@@ -1195,6 +1265,11 @@ Having the real displacement of the head, we can calculate the total movement le
   if (block->step_event_count.wide <= 32767)
     block->flag |= BLOCK_FLAG_DDA_LOWRES;
 
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+  extrusion_e_steps += block_extrusion_steps(block);
+  extrusion_duration += block->millimeters / block->nominal_speed;
+#endif /* PID_EXTRUSION_RATE_FEED_FORWARD */
+
   // Move the buffer head. From now the block may be picked up by the stepper interrupt controller.
   block_buffer_head = next_buffer_head;
 
@@ -1347,6 +1422,17 @@ void planner_queue_min_reset()
 {
   g_cntr_planner_queue_min = moves_planned();
 }
+
+void planner_stats_reset()
+{
+  memset(&planner_stats, 0, sizeof(planner_stats));
+  planner_stats.queue_min = BLOCK_BUFFER_SIZE;
+}
+
+void planner_stats_expect_drain()
+{
+  g_planner_drain_expected = true;
+}
 #endif /* PLANNER_DIAGNOSTICS */
 
 void planner_add_sd_length(uint16_t sdlen)
@@ -25,6 +25,7 @@
 #define planner_h
 
 #include "Marlin.h"
+#include <stddef.h>
 
 #ifdef ENABLE_AUTO_BED_LEVELING
 #include "vector_3.h"
@@ -66,18 +67,35 @@ union dda_usteps_t
 
 // This struct is used when buffering the setup for each linear movement "nominal" values are as specified in 
 // the source g-code and may never actually be reached if acceleration management is active.
+// The fields read by the stepper interrupt come first, so that they are reachable by the AVR
+// displacement addressing (up to 63 bytes from the block pointer), the planner only fields follow.
 typedef struct {
   // Fields used by the bresenham algorithm for tracing the line
-  // steps_x.y,z, step_event_count, acceleration_rate, direction_bits and active_extruder are set by plan_buffer_line().
+  // steps_x.y,z, step_event_count, acceleration_rate and direction_bits are set by plan_buffer_line().
   dda_isteps_t steps_x, steps_y, steps_z, steps_e;  // Step count along each axis
   dda_usteps_t step_event_count;            // The number of step events required to complete this block
   long acceleration_rate;                   // The acceleration rate used for acceleration calculation
-  unsigned char direction_bits;             // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-  unsigned char active_extruder;            // Selects the active extruder
   // accelerate_until and decelerate_after are set by calculate_trapezoid_for_block() and they need to be synchronized with the stepper interrupt controller.
   long accelerate_until;                    // The index of the step event on which to stop acceleration
   long decelerate_after;                    // The index of the step event on which to start decelerating
 
+  // Settings for the trapezoid generator (runs inside an interrupt handler).
+  // Changing the following values in the planner needs to be synchronized with the interrupt handler by disabling the interrupts.
+  // The rates are limited to uint16_t by MultiU24X24toH16 in the stepper interrupt and by MAX_STEP_FREQUENCY.
+  uint16_t nominal_rate;                    // The nominal step rate for this block in step_events/sec 
+  uint16_t initial_rate;                    // The jerk-adjusted step rate at start of block  
+  uint16_t final_rate;                      // The minimal rate at exit
+
+  unsigned char direction_bits;             // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+  // Bit flags defined by the BlockFlag enum.
+  uint8_t flag;
+  volatile char busy;
+
+#ifdef LIN_ADVANCE
+  bool use_advance_lead;
+  unsigned long abs_adv_steps_multiplier8; // Factorised by 2^8 to avoid float
+#endif
+
   // Fields used by the motion planner to manage acceleration
 //  float speed_x, speed_y, speed_z, speed_e;        // Nominal mm/sec for each axis
   // The nominal speed for this block in mm/sec.
@@ -93,32 +111,21 @@ typedef struct {
   // acceleration mm/sec^2
   float acceleration;
 
-  // Bit flags defined by the BlockFlag enum.
-  uint8_t flag;
-
-  // Settings for the trapezoid generator (runs inside an interrupt handler).
-  // Changing the following values in the planner needs to be synchronized with the interrupt handler by disabling the interrupts.
-  //FIXME nominal_rate, initial_rate and final_rate are limited to uint16_t by MultiU24X24toH16 in the stepper interrupt anyway!
-  unsigned long nominal_rate;                        // The nominal step rate for this block in step_events/sec 
-  unsigned long initial_rate;                        // The jerk-adjusted step rate at start of block  
-  unsigned long final_rate;                          // The minimal rate at exit
-  unsigned long acceleration_st;                     // acceleration steps/sec^2
-  //FIXME does it have to be unsigned long? Probably uint8_t would be just fine.
-  unsigned long fan_speed;
-  volatile char busy;
-
+  unsigned long acceleration_st;            // acceleration steps/sec^2
 
   // Pre-calculated division for the calculate_trapezoid_for_block() routine to run faster.
   float speed_factor;
-    
-#ifdef LIN_ADVANCE
-  bool use_advance_lead;
-  unsigned long abs_adv_steps_multiplier8; // Factorised by 2^8 to avoid float
-#endif
 
+  uint8_t fan_speed;
   uint16_t sdlen;
 } block_t;
 
+#ifdef __AVR__
+// RAM budget of a single block, BLOCK_BUFFER_SIZE of them are allocated.
+static_assert(sizeof(block_t) <= 77, "block_t exceeds its RAM budget.");
+static_assert(offsetof(block_t, nominal_speed) <= 64, "block_t fields used by the stepper interrupt shall fit the first 64 bytes.");
+#endif //__AVR__
+
 #ifdef LIN_ADVANCE
   extern float extruder_advance_k, advance_ed_ratio;
 #endif
@@ -187,6 +194,9 @@ extern uint8_t maxlimit_status;
     
 
 
+static_assert(BLOCK_BUFFER_SIZE >= 4 && BLOCK_BUFFER_SIZE <= 128 && (BLOCK_BUFFER_SIZE & (BLOCK_BUFFER_SIZE - 1)) == 0,
+  "BLOCK_BUFFER_SIZE shall be a power of two, indexed by an unsigned char.");
+
 extern block_t block_buffer[BLOCK_BUFFER_SIZE];            // A ring buffer for motion instfructions
 // Index of the next block to be pushed into the planner queue.
 extern volatile unsigned char block_buffer_head;
@@ -239,11 +249,32 @@ FORCE_INLINE bool planner_queue_full() {
 // update planner's current position and the current_position of the front end.
 extern void planner_abort_hard();
 
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+// Filament volume per second of the moves in the planner queue [mm^3/s], averaged over their nominal duration.
+// Retractions do not melt any filament.
+extern float planner_extrusion_rate();
+#endif /* PID_EXTRUSION_RATE_FEED_FORWARD */
+
 #ifdef PREVENT_DANGEROUS_EXTRUDE
 void set_extrude_min_temp(float temp);
 #endif
 
 void reset_acceleration_rates();
+
+#ifdef PLANNER_DIAGNOSTICS
+//! Planner queue occupancy telemetry, accumulated since the last planner_stats_reset().
+//! The occupancy is sampled each time a new block is submitted to plan_buffer_line().
+//! An underrun is an episode of the stepper interrupt running out of blocks while the motion was expected to continue,
+//! that is not after a st_synchronize() or a planner abort, which drain the queue on purpose.
+typedef struct
+{
+  uint8_t  queue_min;    //!< Minimum number of queued blocks seen by a new block.
+  uint32_t queue_sum;    //!< Sum of the occupancy samples, for the average.
+  uint16_t samples;      //!< Number of the occupancy samples, saturates.
+  uint16_t underruns;    //!< Number of underrun episodes, saturates.
+  uint32_t starved_ms;   //!< Milliseconds the stepper spent starving in the underruns.
+} planner_stats_t;
+#endif /* PLANNER_DIAGNOSTICS */
 #endif
 
 void update_mode_profile();
@@ -256,6 +287,15 @@ unsigned char number_of_blocks();
 extern uint8_t planner_queue_min();
 // Diagnostic function: Reset the minimum planner segments.
 extern void planner_queue_min_reset();
+
+extern planner_stats_t planner_stats;
+//! Milliseconds the stepper interrupt found the queue empty, incremented by its 1kHz idle tick
+//! and collected by the planner, when the next block arrives.
+extern volatile uint16_t planner_queue_empty_ms;
+
+extern void planner_stats_reset();
+//! Called by st_synchronize(): the queue is being drained on purpose, the following idle time is not an underrun.
+extern void planner_stats_expect_drain();
 #endif /* PLANNER_DIAGNOSTICS */
 
 extern void planner_add_sd_length(uint16_t sdlen);
@@ -217,12 +217,36 @@ asm volatile ( \
 
 #else //_NO_ASM
 
+// C equivalents of the assembly routines above, producing bit identical results.
+// Used by the host simulation of the stepper routine.
+
+// intRes = charIn1 * intIn2 >> 8
+// The assembly routine adds bit 0 of the dropped low byte, so does this one.
 void MultiU16X8toH16(unsigned short& intRes, unsigned char& charIn1, unsigned short& intIn2)
 {
+  uint16_t lo = (uint16_t)charIn1 * (uint8_t)intIn2;
+  intRes = (uint16_t)charIn1 * (uint8_t)(intIn2 >> 8) + (lo >> 8) + (lo & 1);
 }
 
+// intRes = longIn1 * longIn2 >> 24, of the lower 24 bits of the operands.
+// The assembly routine skips the least significant partial products,
+// therefore they are skipped here as well.
 void MultiU24X24toH16(uint16_t& intRes, int32_t& longIn1, long& longIn2)
 {
+  uint8_t a1 = longIn1, b1 = longIn1 >> 8, c1 = longIn1 >> 16;
+  uint8_t a2 = longIn2, b2 = longIn2 >> 8, c2 = longIn2 >> 16;
+  uint16_t res = (uint16_t)b1 * c2;
+  res += (uint8_t)((uint16_t)c1 * c2) << 8;
+  res += (uint16_t)c1 * b2;
+  // r27 of the assembly routine, byte 1 of the result.
+  uint16_t r27 = ((uint16_t)a1 * b2) >> 8;
+  uint16_t p;
+  p = (uint16_t)a1 * c2; r27 += p & 0x0ff; res += (p >> 8) + (r27 >> 8); r27 &= 0x0ff;
+  p = (uint16_t)b1 * b2; r27 += p & 0x0ff; res += (p >> 8) + (r27 >> 8); r27 &= 0x0ff;
+  p = (uint16_t)c1 * a2; r27 += p & 0x0ff; res += (p >> 8) + (r27 >> 8); r27 &= 0x0ff;
+  p = (uint16_t)b1 * a2; r27 += p >> 8;    res += r27 >> 8; r27 &= 0x0ff;
+  // The assembly routine adds bit 0 of r27.
+  intRes = res + (r27 & 1);
 }
 
 #endif //_NO_ASM
@@ -336,17 +360,16 @@ FORCE_INLINE unsigned short calc_timer(uint16_t step_rate) {
   if(step_rate < (F_CPU/500000)) step_rate = (F_CPU/500000);
   step_rate -= (F_CPU/500000); // Correct for minimal speed
   if(step_rate >= (8*256)){ // higher step rate
-    unsigned short table_address = (unsigned short)&speed_lookuptable_fast[(unsigned char)(step_rate>>8)][0];
+    const uint16_t *table_address = speed_lookuptable_fast[(unsigned char)(step_rate>>8)];
     unsigned char tmp_step_rate = (step_rate & 0x00ff);
-    unsigned short gain = (unsigned short)pgm_read_word_near(table_address+2);
+    unsigned short gain = (unsigned short)pgm_read_word_near(table_address+1);
     MultiU16X8toH16(timer, tmp_step_rate, gain);
     timer = (unsigned short)pgm_read_word_near(table_address) - timer;
   }
   else { // lower step rates
-    unsigned short table_address = (unsigned short)&speed_lookuptable_slow[0][0];
-    table_address += ((step_rate)>>1) & 0xfffc;
+    const uint16_t *table_address = speed_lookuptable_slow[step_rate>>3];
     timer = (unsigned short)pgm_read_word_near(table_address);
-    timer -= (((unsigned short)pgm_read_word_near(table_address+2) * (unsigned char)(step_rate & 0x0007))>>3);
+    timer -= (((unsigned short)pgm_read_word_near(table_address+1) * (unsigned char)(step_rate & 0x0007))>>3);
   }
   if(timer < 100) { timer = 100; MYSERIAL.print(_N("Steprate too high: ")); MYSERIAL.println(step_rate); }//(20kHz this should never happen)////MSG_STEPPER_TOO_HIGH
   return timer;
@@ -570,6 +593,11 @@ FORCE_INLINE void stepper_next_block()
   }
   else {
     OCR1A = 2000; // 1kHz.
+#ifdef PLANNER_DIAGNOSTICS
+    // Each idle tick is a millisecond without a block.
+    if (planner_queue_empty_ms != 0xffff)
+      ++ planner_queue_empty_ms;
+#endif /* PLANNER_DIAGNOSTICS */
   }
   //WRITE_NC(LOGIC_ANALYZER_CH2, false);
 }
@@ -1362,6 +1390,9 @@ void st_init()
 // Block until all buffered steps are executed
 void st_synchronize()
 {
+#ifdef PLANNER_DIAGNOSTICS
+	planner_stats_expect_drain();
+#endif /* PLANNER_DIAGNOSTICS */
 	while(blocks_queued())
 	{
 #ifdef TMC2130
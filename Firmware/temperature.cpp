@@ -43,6 +43,8 @@
 #include "messages.h"
 #include "Timer.h"
 #include "Configuration_prusa.h"
+#include "thermistor.h"
+#include "heater_pid.h"
 
 //===========================================================================
 //=============================public variables============================
@@ -103,32 +105,34 @@ unsigned char soft_pwm_bed;
 //===========================================================================
 static volatile bool temp_meas_ready = false;
 
+#ifdef FIXED_POINT_PID
+  #ifdef PonM
+    #error FIXED_POINT_PID does not implement PonM
+  #endif
+  typedef pid_fixed_param_t heater_pid_param_t;
+  typedef pid_fixed_state_t heater_pid_state_t;
+  #define heater_pid_set pid_fixed_set
+  #define heater_pid_input(input) PID_FIXED(input)
+  #define heater_pid_term(term) ((term) / 256.f)
+  #define heater_pid_update(param, state, target, input) pid_fixed_update(param, state, (int32_t)(target) << 8, PID_FIXED(input))
+#else
+  typedef pid_param_t heater_pid_param_t;
+  typedef pid_state_t heater_pid_state_t;
+  #define heater_pid_set pid_set
+  #define heater_pid_input(input) (input)
+  #define heater_pid_term(term) (term)
+  #define heater_pid_update pid_update
+#endif //FIXED_POINT_PID
 #ifdef PIDTEMP
   //static cannot be external:
-  static float iState_sum[EXTRUDERS] = { 0 };
-  static float dState_last[EXTRUDERS] = { 0 };
-  static float pTerm[EXTRUDERS];
-  static float iTerm[EXTRUDERS];
-  static float dTerm[EXTRUDERS];
-  //int output;
-  static float pid_error[EXTRUDERS];
-  static float iState_sum_min[EXTRUDERS];
-  static float iState_sum_max[EXTRUDERS];
-  // static float pid_input[EXTRUDERS];
-  // static float pid_output[EXTRUDERS];
+  static heater_pid_param_t pid_param;
+  static heater_pid_state_t pid_state[EXTRUDERS];
   static bool pid_reset[EXTRUDERS];
 #endif //PIDTEMP
 #ifdef PIDTEMPBED
   //static cannot be external:
-  static float temp_iState_bed = { 0 };
-  static float temp_dState_bed = { 0 };
-  static float pTerm_bed;
-  static float iTerm_bed;
-  static float dTerm_bed;
-  //int output;
-  static float pid_error_bed;
-  static float temp_iState_min_bed;
-  static float temp_iState_max_bed;
+  static heater_pid_param_t bed_pid_param;
+  static heater_pid_state_t bed_pid_state;
 #else //PIDTEMPBED
 	static unsigned long  previous_millis_bed_heater;
 #endif //PIDTEMPBED
@@ -171,7 +175,37 @@ static int bed_minttemp_raw = HEATER_BED_RAW_LO_TEMP;
 static int bed_maxttemp_raw = HEATER_BED_RAW_HI_TEMP;
 #endif
 
+// Interpolation slopes of the thermistor tables, calculated by the compiler.
+#define THERMISTOR_SLOPES(name, table, len) \
+  static_assert(thermistor_sorted(table), #table " is not sorted by the raw value"); \
+  static constexpr thermistor_slopes_t<len> name PROGMEM = thermistor_make_slopes(table)
+#ifdef THERMISTORHEATER_0
+THERMISTOR_SLOPES(heater_0_slopes, HEATER_0_TEMPTABLE, HEATER_0_TEMPTABLE_LEN);
+# define HEATER_0_SLOPES heater_0_slopes.slope
+#else
+# define HEATER_0_SLOPES NULL
+#endif
+#ifdef THERMISTORHEATER_1
+THERMISTOR_SLOPES(heater_1_slopes, HEATER_1_TEMPTABLE, HEATER_1_TEMPTABLE_LEN);
+# define HEATER_1_SLOPES heater_1_slopes.slope
+#else
+# define HEATER_1_SLOPES NULL
+#endif
+#ifdef THERMISTORHEATER_2
+THERMISTOR_SLOPES(heater_2_slopes, HEATER_2_TEMPTABLE, HEATER_2_TEMPTABLE_LEN);
+# define HEATER_2_SLOPES heater_2_slopes.slope
+#else
+# define HEATER_2_SLOPES NULL
+#endif
+#ifdef BED_USES_THERMISTOR
+THERMISTOR_SLOPES(bed_slopes, BEDTEMPTABLE, BEDTEMPTABLE_LEN);
+#endif
+#ifdef AMBIENT_THERMISTOR
+THERMISTOR_SLOPES(ambient_slopes, AMBIENTTEMPTABLE, AMBIENTTEMPTABLE_LEN);
+#endif
+
 static void *heater_ttbl_map[EXTRUDERS] = ARRAY_BY_EXTRUDERS( (void *)HEATER_0_TEMPTABLE, (void *)HEATER_1_TEMPTABLE, (void *)HEATER_2_TEMPTABLE );
+static const float *heater_slope_map[EXTRUDERS] = ARRAY_BY_EXTRUDERS( HEATER_0_SLOPES, HEATER_1_SLOPES, HEATER_2_SLOPES );
 static uint8_t heater_ttbllen_map[EXTRUDERS] = ARRAY_BY_EXTRUDERS( HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN, HEATER_2_TEMPTABLE_LEN );
 
 static float analog2temp(int raw, uint8_t e);
@@ -418,12 +452,10 @@ static void temp_runaway_stop(bool isPreheat, bool isBed);
 void updatePID()
 {
 #ifdef PIDTEMP
-  for(uint_least8_t e = 0; e < EXTRUDERS; e++) {
-     iState_sum_max[e] = PID_INTEGRAL_DRIVE_MAX / cs.Ki;  
-  }
+  heater_pid_set(&pid_param, cs.Kp, cs.Ki, cs.Kd, PID_K1, PID_INTEGRAL_DRIVE_MAX, PID_MAX);
 #endif
 #ifdef PIDTEMPBED
-  temp_iState_max_bed = PID_INTEGRAL_DRIVE_MAX / cs.bedKi;  
+  heater_pid_set(&bed_pid_param, cs.bedKp, cs.bedKi, cs.bedKd, PID_K1, PID_INTEGRAL_DRIVE_MAX, MAX_BED_POWER);
 #endif
 }
   
@@ -621,7 +653,11 @@ void manage_heater()
 #endif //WATCHDOG
 
   float pid_input;
+#ifdef FIXED_POINT_PID
+  int16_t pid_output;
+#else
   float pid_output;
+#endif
 
   if(temp_meas_ready != true)   //better readability
     return; 
@@ -650,39 +686,36 @@ void manage_heater()
         if(target_temperature[e] == 0) {
           pid_output = 0;
           pid_reset[e] = true;
+          pid_state[e].last = heater_pid_input(pid_input);
         } else {
-          pid_error[e] = target_temperature[e] - pid_input;
           if(pid_reset[e]) {
-            iState_sum[e] = 0.0;
-            dTerm[e] = 0.0;                       // 'dState_last[e]' initial setting is not necessary (see end of if-statement)
+            pid_state[e].i_sum = 0;
+            pid_state[e].d_term = 0;              // 'last' initial setting is not necessary (updated with the target 0 too)
             pid_reset[e] = false;
           }
 #ifndef PonM
-          pTerm[e] = cs.Kp * pid_error[e];
-          iState_sum[e] += pid_error[e];
-          iState_sum[e] = constrain(iState_sum[e], iState_sum_min[e], iState_sum_max[e]);
-          iTerm[e] = cs.Ki * iState_sum[e];
           // PID_K1 defined in Configuration.h in the PID settings
-          #define K2 (1.0-PID_K1)
-          dTerm[e] = (cs.Kd * (pid_input - dState_last[e]))*K2 + (PID_K1 * dTerm[e]); // e.g. digital filtration of derivative term changes
-          pid_output = pTerm[e] + iTerm[e] - dTerm[e]; // subtraction due to "Derivative on Measurement" method (i.e. derivative of input instead derivative of error is used)
-          if (pid_output > PID_MAX) {
-            if (pid_error[e] > 0 ) iState_sum[e] -= pid_error[e]; // conditional un-integration
-            pid_output=PID_MAX;
-          } else if (pid_output < 0) {
-            if (pid_error[e] < 0 ) iState_sum[e] -= pid_error[e]; // conditional un-integration
-            pid_output=0;
-          }
+          pid_output = heater_pid_update(&pid_param, &pid_state[e], target_temperature[e], pid_input);
 #else // PonM ("Proportional on Measurement" method)
-          iState_sum[e] += cs.Ki * pid_error[e];
-          iState_sum[e] -= cs.Kp * (pid_input - dState_last[e]);
-          iState_sum[e] = constrain(iState_sum[e], 0, PID_INTEGRAL_DRIVE_MAX);
-          dTerm[e] = cs.Kd * (pid_input - dState_last[e]);
-          pid_output = iState_sum[e] - dTerm[e];  // subtraction due to "Derivative on Measurement" method (i.e. derivative of input instead derivative of error is used)
+          float pid_error = target_temperature[e] - pid_input;
+          pid_state[e].i_sum += cs.Ki * pid_error;
+          pid_state[e].i_sum -= cs.Kp * (pid_input - pid_state[e].last);
+          pid_state[e].i_sum = constrain(pid_state[e].i_sum, 0, PID_INTEGRAL_DRIVE_MAX);
+          pid_state[e].d_term = cs.Kd * (pid_input - pid_state[e].last);
+          pid_output = pid_state[e].i_sum - pid_state[e].d_term;  // subtraction due to "Derivative on Measurement" method (i.e. derivative of input instead derivative of error is used)
           pid_output = constrain(pid_output, 0, PID_MAX);
+          pid_state[e].last = pid_input;
 #endif // PonM
+#ifdef PID_EXTRUSION_RATE_FEED_FORWARD
+          // Feed-forward of the power melting the queued extrusion.
+          if (e == active_extruder)
+          {
+            pid_output += Kc * planner_extrusion_rate();
+            if (pid_output > PID_MAX)
+              pid_output = PID_MAX;
+          }
+#endif //PID_EXTRUSION_RATE_FEED_FORWARD
         }
-        dState_last[e] = pid_input;
     #else 
           pid_output = constrain(target_temperature[e], 0, PID_MAX);
     #endif //PID_OPENLOOP
@@ -695,11 +728,11 @@ void manage_heater()
     SERIAL_ECHO(" Output ");
     SERIAL_ECHO(pid_output);
     SERIAL_ECHO(" pTerm ");
-    SERIAL_ECHO(pTerm[e]);
+    SERIAL_ECHO(heater_pid_term(pid_state[e].p_term));
     SERIAL_ECHO(" iTerm ");
-    SERIAL_ECHO(iTerm[e]);
+    SERIAL_ECHO(heater_pid_term(pid_state[e].i_term));
     SERIAL_ECHO(" dTerm ");
-    SERIAL_ECHOLN(-dTerm[e]);
+    SERIAL_ECHOLN(-heater_pid_term(pid_state[e].d_term));
     #endif //PID_DEBUG
   #else /* PID off */
     pid_output = 0;
@@ -777,25 +810,8 @@ void manage_heater()
     pid_input = current_temperature_bed;
 
     #ifndef PID_OPENLOOP
-		  pid_error_bed = target_temperature_bed - pid_input;
-		  pTerm_bed = cs.bedKp * pid_error_bed;
-		  temp_iState_bed += pid_error_bed;
-		  temp_iState_bed = constrain(temp_iState_bed, temp_iState_min_bed, temp_iState_max_bed);
-		  iTerm_bed = cs.bedKi * temp_iState_bed;
-
 		  //PID_K1 defined in Configuration.h in the PID settings
-		  #define K2 (1.0-PID_K1)
-		  dTerm_bed= (cs.bedKd * (pid_input - temp_dState_bed))*K2 + (PID_K1 * dTerm_bed);
-		  temp_dState_bed = pid_input;
-
-		  pid_output = pTerm_bed + iTerm_bed - dTerm_bed;
-          	  if (pid_output > MAX_BED_POWER) {
-            	    if (pid_error_bed > 0 )  temp_iState_bed -= pid_error_bed; // conditional un-integration
-                    pid_output=MAX_BED_POWER;
-          	  } else if (pid_output < 0){
-            	    if (pid_error_bed < 0 )  temp_iState_bed -= pid_error_bed; // conditional un-integration
-                    pid_output=0;
-                  }
+		  pid_output = heater_pid_update(&bed_pid_param, &bed_pid_state, target_temperature_bed, pid_input);
 
     #else 
       pid_output = constrain(target_temperature_bed, 0, MAX_BED_POWER);
@@ -864,7 +880,6 @@ void manage_heater()
   host_keepalive();
 }
 
-#define PGM_RD_W(x)   (short)pgm_read_word(&x)
 // Derived from RepRap FiveD extruder::getTemperature()
 // For hot end temperature measurement.
 static float analog2temp(int raw, uint8_t e) {
@@ -885,26 +900,7 @@ static float analog2temp(int raw, uint8_t e) {
 
   if(heater_ttbl_map[e] != NULL)
   {
-    float celsius = 0;
-    uint8_t i;
-    short (*tt)[][2] = (short (*)[][2])(heater_ttbl_map[e]);
-
-    for (i=1; i<heater_ttbllen_map[e]; i++)
-    {
-      if (PGM_RD_W((*tt)[i][0]) > raw)
-      {
-        celsius = PGM_RD_W((*tt)[i-1][1]) + 
-          (raw - PGM_RD_W((*tt)[i-1][0])) * 
-          (float)(PGM_RD_W((*tt)[i][1]) - PGM_RD_W((*tt)[i-1][1])) /
-          (float)(PGM_RD_W((*tt)[i][0]) - PGM_RD_W((*tt)[i-1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == heater_ttbllen_map[e]) celsius = PGM_RD_W((*tt)[i-1][1]);
-
-    return celsius;
+    return thermistor_celsius(raw, (const short (*)[2])heater_ttbl_map[e], heater_slope_map[e], heater_ttbllen_map[e]);
   }
   return ((raw * ((5.0 * 100.0) / 1024.0) / OVERSAMPLENR) * TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET;
 }
@@ -913,23 +909,7 @@ static float analog2temp(int raw, uint8_t e) {
 // For bed temperature measurement.
 static float analog2tempBed(int raw) {
   #ifdef BED_USES_THERMISTOR
-    float celsius = 0;
-    byte i;
-
-    for (i=1; i<BEDTEMPTABLE_LEN; i++)
-    {
-      if (PGM_RD_W(BEDTEMPTABLE[i][0]) > raw)
-      {
-        celsius  = PGM_RD_W(BEDTEMPTABLE[i-1][1]) + 
-          (raw - PGM_RD_W(BEDTEMPTABLE[i-1][0])) * 
-          (float)(PGM_RD_W(BEDTEMPTABLE[i][1]) - PGM_RD_W(BEDTEMPTABLE[i-1][1])) /
-          (float)(PGM_RD_W(BEDTEMPTABLE[i][0]) - PGM_RD_W(BEDTEMPTABLE[i-1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == BEDTEMPTABLE_LEN) celsius = PGM_RD_W(BEDTEMPTABLE[i-1][1]);
+    float celsius = thermistor_celsius(raw, BEDTEMPTABLE, bed_slopes.slope, BEDTEMPTABLE_LEN);
 
 
 	// temperature offset adjustment
@@ -967,23 +947,7 @@ static float analog2tempBed(int raw) {
 #ifdef AMBIENT_THERMISTOR
 static float analog2tempAmbient(int raw)
 {
-    float celsius = 0;
-    byte i;
-
-    for (i=1; i<AMBIENTTEMPTABLE_LEN; i++)
-    {
-      if (PGM_RD_W(AMBIENTTEMPTABLE[i][0]) > raw)
-      {
-        celsius  = PGM_RD_W(AMBIENTTEMPTABLE[i-1][1]) + 
-          (raw - PGM_RD_W(AMBIENTTEMPTABLE[i-1][0])) * 
-          (float)(PGM_RD_W(AMBIENTTEMPTABLE[i][1]) - PGM_RD_W(AMBIENTTEMPTABLE[i-1][1])) /
-          (float)(PGM_RD_W(AMBIENTTEMPTABLE[i][0]) - PGM_RD_W(AMBIENTTEMPTABLE[i-1][0]));
-        break;
-      }
-    }
-    // Overflow: Set to last value in the table
-    if (i == AMBIENTTEMPTABLE_LEN) celsius = PGM_RD_W(AMBIENTTEMPTABLE[i-1][1]);
-    return celsius;
+    return thermistor_celsius(raw, AMBIENTTEMPTABLE, ambient_slopes.slope, AMBIENTTEMPTABLE_LEN);
 }
 #endif //AMBIENT_THERMISTOR
 
@@ -1028,15 +992,8 @@ void tp_init()
   for(int e = 0; e < EXTRUDERS; e++) {
     // populate with the first value 
     maxttemp[e] = maxttemp[0];
-#ifdef PIDTEMP
-    iState_sum_min[e] = 0.0;
-    iState_sum_max[e] = PID_INTEGRAL_DRIVE_MAX / cs.Ki;
-#endif //PIDTEMP
-#ifdef PIDTEMPBED
-    temp_iState_min_bed = 0.0;
-    temp_iState_max_bed = PID_INTEGRAL_DRIVE_MAX / cs.bedKi;
-#endif //PIDTEMPBED
   }
+  updatePID();
 
   #if defined(HEATER_0_PIN) && (HEATER_0_PIN > -1) 
     SET_OUTPUT(HEATER_0_PIN);
@@ -0,0 +1,23 @@
+//! @file
+//! @brief Conversion of the oversampled ADC readings to degrees Celsius by the thermistor tables
+
+#include "thermistor.h"
+#include <avr/pgmspace.h>
+
+float thermistor_celsius(int raw, const short (*table)[2], const float *slope, uint8_t len)
+{
+    // First entry above raw, the same one the former linear scan stopped at.
+    uint8_t lo = 1, hi = len;
+    while (lo < hi) {
+        const uint8_t mid = (lo + hi) >> 1;
+        if ((short)pgm_read_word(&table[mid][0]) > raw)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    // Overflow: the last value in the table
+    if (lo >= len)
+        return (short)pgm_read_word(&table[len - 1][1]);
+    return (short)pgm_read_word(&table[lo - 1][1]) +
+        (raw - (short)pgm_read_word(&table[lo - 1][0])) * pgm_read_float(&slope[lo]);
+}
@@ -0,0 +1,64 @@
+//! @file
+//! @brief Conversion of the oversampled ADC readings to degrees Celsius by the thermistor tables
+//!
+//! The tables of thermistortables.h are { raw, celsius } pairs sorted by the raw value. The entry
+//! above the reading is found by a binary search, the temperature is interpolated by the slope of
+//! the segment below it. The slopes are calculated by the compiler from the table:
+//!
+//!     static constexpr thermistor_slopes_t<BEDTEMPTABLE_LEN> bed_slopes PROGMEM = thermistor_make_slopes(BEDTEMPTABLE);
+//!     static_assert(thermistor_sorted(BEDTEMPTABLE), "BEDTEMPTABLE is not sorted");
+//!     celsius = thermistor_celsius(raw, BEDTEMPTABLE, bed_slopes.slope, BEDTEMPTABLE_LEN);
+
+#ifndef THERMISTOR_H
+#define THERMISTOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//! Slopes of the segments of a table, slope[i] between the entries i-1 and i. slope[0] is not used.
+template<size_t N> struct thermistor_slopes_t
+{
+    float slope[N];
+};
+
+template<size_t... I> struct thermistor_index_t {};
+template<size_t N, size_t... I> struct thermistor_indices_t : thermistor_indices_t<N - 1, N - 1, I...> {};
+template<size_t... I> struct thermistor_indices_t<0, I...> { typedef thermistor_index_t<I...> type; };
+
+//! Segments of the same raw value are never interpolated.
+constexpr float thermistor_slope(const short (*table)[2], size_t i)
+{
+    return (i == 0 || table[i][0] == table[i - 1][0]) ? 0.f :
+        float(table[i][1] - table[i - 1][1]) / float(table[i][0] - table[i - 1][0]);
+}
+
+template<size_t N, size_t... I> constexpr thermistor_slopes_t<N> thermistor_make_slopes(const short (&table)[N][2], thermistor_index_t<I...>)
+{
+    return {{ thermistor_slope(table, I)... }};
+}
+
+template<size_t N> constexpr thermistor_slopes_t<N> thermistor_make_slopes(const short (&table)[N][2])
+{
+    return thermistor_make_slopes(table, typename thermistor_indices_t<N>::type());
+}
+
+//! The binary search requires the raw values not to decrease.
+constexpr bool thermistor_sorted(const short (*table)[2], size_t n)
+{
+    return n < 2 || (table[n - 1][0] >= table[n - 2][0] && thermistor_sorted(table, n - 1));
+}
+
+template<size_t N> constexpr bool thermistor_sorted(const short (&table)[N][2])
+{
+    return thermistor_sorted(table, N);
+}
+
+//! @brief Temperature of an oversampled ADC reading.
+//!
+//! Interpolates below the first entry above raw, returns the temperature of the last entry if there is none.
+//! @param table thermistor table in the program memory
+//! @param slope thermistor_make_slopes() of the table in the program memory
+//! @param len number of the table entries
+float thermistor_celsius(int raw, const short (*table)[2], const float *slope, uint8_t len);
+
+#endif /* THERMISTOR_H */
@@ -6,9 +6,16 @@
 
 #define OVERSAMPLENR 16
 
+// The C++ sources calculate the interpolation slopes of the tables at compile time, see thermistor.h.
+#ifdef __cplusplus
+# define TEMPTABLE_CONST constexpr
+#else
+# define TEMPTABLE_CONST const
+#endif
+
 #if (THERMISTORHEATER_0 == 1) || (THERMISTORHEATER_1 == 1)  || (THERMISTORHEATER_2 == 1) || (THERMISTORBED == 1) //100k bed thermistor
 
-const short temptable_1[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_1[][2] PROGMEM = {
 {       23*OVERSAMPLENR ,       300     },
 {       25*OVERSAMPLENR ,       295     },
 {       27*OVERSAMPLENR ,       290     },
@@ -73,7 +80,7 @@ const short temptable_1[][2] PROGMEM = {
 };
 #endif
 #if (THERMISTORHEATER_0 == 2) || (THERMISTORHEATER_1 == 2) || (THERMISTORHEATER_2 == 2) || (THERMISTORBED == 2) //200k bed thermistor
-const short temptable_2[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_2[][2] PROGMEM = {
 //200k ATC Semitec 204GT-2
 //Verified by linagee. Source: http://shop.arcol.hu/static/datasheets/thermistors.pdf
 // Calculated using 4.7kohm pullup, voltage divider math, and manufacturer provided temp/resistance
@@ -113,7 +120,7 @@ const short temptable_2[][2] PROGMEM = {
 
 #endif
 #if (THERMISTORHEATER_0 == 3) || (THERMISTORHEATER_1 == 3) || (THERMISTORHEATER_2 == 3) || (THERMISTORBED == 3) //mendel-parts
-const short temptable_3[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_3[][2] PROGMEM = {
                 {1*OVERSAMPLENR,864},
                 {21*OVERSAMPLENR,300},
                 {25*OVERSAMPLENR,290},
@@ -146,7 +153,7 @@ const short temptable_3[][2] PROGMEM = {
 
 #endif
 #if (THERMISTORHEATER_0 == 4) || (THERMISTORHEATER_1 == 4) || (THERMISTORHEATER_2 == 4) || (THERMISTORBED == 4) //10k thermistor
-const short temptable_4[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_4[][2] PROGMEM = {
    {1*OVERSAMPLENR, 430},
    {54*OVERSAMPLENR, 137},
    {107*OVERSAMPLENR, 107},
@@ -171,7 +178,7 @@ const short temptable_4[][2] PROGMEM = {
 #endif
 
 #if (THERMISTORHEATER_0 == 5) || (THERMISTORHEATER_1 == 5) || (THERMISTORHEATER_2 == 5) || (THERMISTORBED == 5) //100k ParCan thermistor (104GT-2)
-const short temptable_5[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_5[][2] PROGMEM = {
 // ATC Semitec 104GT-2 (Used in ParCan)
 // Verified by linagee. Source: http://shop.arcol.hu/static/datasheets/thermistors.pdf
 // Calculated using 4.7kohm pullup, voltage divider math, and manufacturer provided temp/resistance
@@ -211,7 +218,7 @@ const short temptable_5[][2] PROGMEM = {
 #endif
 
 #if (THERMISTORHEATER_0 == 6) || (THERMISTORHEATER_1 == 6) || (THERMISTORHEATER_2 == 6) || (THERMISTORBED == 6) // 100k Epcos thermistor
-const short temptable_6[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_6[][2] PROGMEM = {
    {1*OVERSAMPLENR, 350},
    {28*OVERSAMPLENR, 250}, //top rating 250C
    {31*OVERSAMPLENR, 245},
@@ -254,7 +261,7 @@ const short temptable_6[][2] PROGMEM = {
 #endif
 
 #if (THERMISTORHEATER_0 == 7) || (THERMISTORHEATER_1 == 7) || (THERMISTORHEATER_2 == 7) || (THERMISTORBED == 7) // 100k Honeywell 135-104LAG-J01
-const short temptable_7[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_7[][2] PROGMEM = {
    {1*OVERSAMPLENR, 941},
    {19*OVERSAMPLENR, 362},
    {37*OVERSAMPLENR, 299}, //top rating 300C
@@ -322,7 +329,7 @@ const short temptable_7[][2] PROGMEM = {
 // Beta = 3974
 // R1 = 0 Ohm
 // R2 = 4700 Ohm
-const short temptable_71[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_71[][2] PROGMEM = {
    {35*OVERSAMPLENR, 300},
    {51*OVERSAMPLENR, 270},
    {54*OVERSAMPLENR, 265},
@@ -469,7 +476,7 @@ const short temptable_71[][2] PROGMEM = {
 
 #if (THERMISTORHEATER_0 == 8) || (THERMISTORHEATER_1 == 8) || (THERMISTORHEATER_2 == 8) || (THERMISTORBED == 8)
 // 100k 0603 SMD Vishay NTCS0603E3104FXT (4.7k pullup)
-const short temptable_8[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_8[][2] PROGMEM = {
    {1*OVERSAMPLENR, 704},
    {54*OVERSAMPLENR, 216},
    {107*OVERSAMPLENR, 175},
@@ -494,7 +501,7 @@ const short temptable_8[][2] PROGMEM = {
 #endif
 #if (THERMISTORHEATER_0 == 9) || (THERMISTORHEATER_1 == 9) || (THERMISTORHEATER_2 == 9) || (THERMISTORBED == 9)
 // 100k GE Sensing AL03006-58.2K-97-G1 (4.7k pullup)
-const short temptable_9[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_9[][2] PROGMEM = {
 	{1*OVERSAMPLENR, 936},
 	{36*OVERSAMPLENR, 300},
 	{71*OVERSAMPLENR, 246},
@@ -530,7 +537,7 @@ const short temptable_9[][2] PROGMEM = {
 #endif
 #if (THERMISTORHEATER_0 == 10) || (THERMISTORHEATER_1 == 10) || (THERMISTORHEATER_2 == 10) || (THERMISTORBED == 10)
 // 100k RS thermistor 198-961 (4.7k pullup)
-const short temptable_10[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_10[][2] PROGMEM = {
    {1*OVERSAMPLENR, 929},
    {36*OVERSAMPLENR, 299},
    {71*OVERSAMPLENR, 246},
@@ -568,7 +575,7 @@ const short temptable_10[][2] PROGMEM = {
 #if (THERMISTORHEATER_0 == 11) || (THERMISTORHEATER_1 == 11) || (THERMISTORHEATER_2 == 11) || (THERMISTORBED == 11) 
 // QU-BD silicone bed QWG-104F-3950 thermistor
 
-const short temptable_11[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_11[][2] PROGMEM = {
          {1*OVERSAMPLENR,        938},
          {31*OVERSAMPLENR,       314},
          {41*OVERSAMPLENR,       290},
@@ -625,7 +632,7 @@ const short temptable_11[][2] PROGMEM = {
 #if (THERMISTORHEATER_0 == 13) || (THERMISTORHEATER_1 == 13) || (THERMISTORHEATER_2 == 13) || (THERMISTORBED == 13)
 // Hisens thermistor B25/50 =3950 +/-1%
 
-const short temptable_13[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_13[][2] PROGMEM = {
  {	22.5*OVERSAMPLENR,	300	},
 {	24.125*OVERSAMPLENR,	295	},
 {	25.875*OVERSAMPLENR,	290	},
@@ -710,7 +717,7 @@ This does not match the normal thermistor behaviour so we need to set the follow
 # define HEATER_BED_RAW_HI_TEMP 16383
 # define HEATER_BED_RAW_LO_TEMP 0
 #endif
-const short temptable_20[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_20[][2] PROGMEM = {
 {         0*OVERSAMPLENR ,       0     },
 {       227*OVERSAMPLENR ,       1     },
 {       236*OVERSAMPLENR ,       10     },
@@ -768,7 +775,7 @@ const short temptable_20[][2] PROGMEM = {
 // Verified by linagee.
 // Calculated using 1kohm pullup, voltage divider math, and manufacturer provided temp/resistance
 // Advantage: Twice the resolution and better linearity from 150C to 200C
-const short temptable_51[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_51[][2] PROGMEM = {
    {1*OVERSAMPLENR, 350},
    {190*OVERSAMPLENR, 250}, //top rating 250C
    {203*OVERSAMPLENR, 245},
@@ -830,7 +837,7 @@ const short temptable_51[][2] PROGMEM = {
 // Verified by linagee. Source: http://shop.arcol.hu/static/datasheets/thermistors.pdf
 // Calculated using 1kohm pullup, voltage divider math, and manufacturer provided temp/resistance
 // Advantage: More resolution and better linearity from 150C to 200C
-const short temptable_52[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_52[][2] PROGMEM = {
    {1*OVERSAMPLENR, 500},
    {125*OVERSAMPLENR, 300}, //top rating 300C
    {142*OVERSAMPLENR, 290},
@@ -871,7 +878,7 @@ const short temptable_52[][2] PROGMEM = {
 // Verified by linagee. Source: http://shop.arcol.hu/static/datasheets/thermistors.pdf
 // Calculated using 1kohm pullup, voltage divider math, and manufacturer provided temp/resistance
 // Advantage: More resolution and better linearity from 150C to 200C
-const short temptable_55[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_55[][2] PROGMEM = {
    {1*OVERSAMPLENR, 500},
    {76*OVERSAMPLENR, 300},
    {87*OVERSAMPLENR, 290},
@@ -916,7 +923,7 @@ const short temptable_55[][2] PROGMEM = {
 // beta: 3950
 // min adc: 1 at 0.0048828125 V
 // max adc: 1023 at 4.9951171875 V
-const short temptable_60[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_60[][2] PROGMEM = {
    {51*OVERSAMPLENR, 272},
    {61*OVERSAMPLENR, 258},
    {71*OVERSAMPLENR, 247},
@@ -993,7 +1000,7 @@ const short temptable_60[][2] PROGMEM = {
 #endif
 #if (THERMISTORBED == 12) 
 //100k 0603 SMD Vishay NTCS0603E3104FXT (4.7k pullup) (calibrated for Makibox hot bed)
-const short temptable_12[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_12[][2] PROGMEM = {
    {35*OVERSAMPLENR, 180}, //top rating 180C
    {211*OVERSAMPLENR, 140},
    {233*OVERSAMPLENR, 135},
@@ -1041,7 +1048,7 @@ const short temptable_12[][2] PROGMEM = {
 #define PtLine(T,R0,Rup) { PtAdVal(T,R0,Rup)*OVERSAMPLENR, T },
 
 #if (THERMISTORHEATER_0 == 110) || (THERMISTORHEATER_1 == 110) || (THERMISTORHEATER_2 == 110) || (THERMISTORBED == 110) // Pt100 with 1k0 pullup
-const short temptable_110[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_110[][2] PROGMEM = {
 // only few values are needed as the curve is very flat  
   PtLine(0,100,1000)
   PtLine(50,100,1000)
@@ -1053,7 +1060,7 @@ const short temptable_110[][2] PROGMEM = {
 };
 #endif
 #if (THERMISTORHEATER_0 == 147) || (THERMISTORHEATER_1 == 147) || (THERMISTORHEATER_2 == 147) || (THERMISTORBED == 147) // Pt100 with 4k7 pullup
-const short temptable_147[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_147[][2] PROGMEM = {
 // only few values are needed as the curve is very flat  
   PtLine(0,100,4700)
   PtLine(50,100,4700)
@@ -1066,7 +1073,7 @@ const short temptable_147[][2] PROGMEM = {
 #endif
 // E3D Pt100 with 4k7 MiniRambo pullup, no Amp on the MiniRambo v1.3a
 #if (THERMISTORHEATER_0 == 148) || (THERMISTORHEATER_1 == 148) || (THERMISTORHEATER_2 == 148) || (THERMISTORBED == 148)
-const short temptable_148[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_148[][2] PROGMEM = {
 // These values have been calculated and tested over many days.  See https://docs.google.com/spreadsheets/d/1MJXa6feEe0mGVCT2TrBwLxVOMoLDkJlvfQ4JXhAdV_E
 // Values that are missing from the 5C gap are missing due to resolution limits.
 {19.00000 * OVERSAMPLENR,  0},
@@ -1091,7 +1098,7 @@ const short temptable_148[][2] PROGMEM = {
 {29.00000 * OVERSAMPLENR,125},
 {29.25000 * OVERSAMPLENR,135},
 {30.00000 * OVERSAMPLENR,140},
-{35.50000 * OVERSAMPLENR,150},
+{30.50000 * OVERSAMPLENR,150},
 {31.00000 * OVERSAMPLENR,155},
 {32.00000 * OVERSAMPLENR,165},
 {32.18750 * OVERSAMPLENR,175},
@@ -1128,7 +1135,7 @@ const short temptable_148[][2] PROGMEM = {
 };
 #endif
 #if (THERMISTORHEATER_0 == 247) || (THERMISTORHEATER_1 == 247) || (THERMISTORHEATER_2 == 247) || (THERMISTORBED == 247) // Pt100 with 4k7 MiniRambo pullup & PT100 Amplifier
-const short temptable_247[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_247[][2] PROGMEM = {
 // Calculated from Bob-the-Kuhn's PT100 calculator listed in https://github.com/MarlinFirmware/Marlin/issues/5543
 // and the table provided by E3D at http://wiki.e3d-online.com/wiki/E3D_PT100_Amplifier_Documentation#Output_Characteristics.
 {  0 * OVERSAMPLENR,    0},
@@ -1183,7 +1190,7 @@ const short temptable_247[][2] PROGMEM = {
 };
 #endif
 #if (THERMISTORHEATER_0 == 1010) || (THERMISTORHEATER_1 == 1010) || (THERMISTORHEATER_2 == 1010) || (THERMISTORBED == 1010) // Pt1000 with 1k0 pullup
-const short temptable_1010[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_1010[][2] PROGMEM = {
   PtLine(0,1000,1000)
   PtLine(25,1000,1000)
   PtLine(50,1000,1000)
@@ -1200,7 +1207,7 @@ const short temptable_1010[][2] PROGMEM = {
 };
 #endif
 #if (THERMISTORHEATER_0 == 1047) || (THERMISTORHEATER_1 == 1047) || (THERMISTORHEATER_2 == 1047) || (THERMISTORBED == 1047) // Pt1000 with 4k7 pullup
-const short temptable_1047[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_1047[][2] PROGMEM = {
 // only few values are needed as the curve is very flat  
   PtLine(0,1000,4700)
   PtLine(50,1000,4700)
@@ -1213,7 +1220,7 @@ const short temptable_1047[][2] PROGMEM = {
 #endif
 
 #if (THERMISTORAMBIENT == 2000) //100k thermistor NTCG104LH104JT1
-const short temptable_2000[][2] PROGMEM = {
+TEMPTABLE_CONST short temptable_2000[][2] PROGMEM = {
 // Source: https://product.tdk.com/info/en/catalog/datasheets/503021/tpd_ntc-thermistor_ntcg_en.pdf
 // Calculated using 4.7kohm pullup, voltage divider math, and manufacturer provided temp/resistance
 /*{305*OVERSAMPLENR, 125},
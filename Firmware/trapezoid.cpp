@@ -0,0 +1,59 @@
+//! @file
+//! @brief Step domain trapezoid generator of the planner
+
+#include "trapezoid.h"
+
+//! @brief Split a block into the acceleration, plateau and deceleration phases
+//!
+//! All the rates are in steps/sec, the acceleration in steps/sec^2.
+//! The initial and final rates shall not exceed the nominal rate.
+//! @param accelerate_steps number of steps to accelerate
+//! @param plateau_steps number of steps at the nominal rate
+void trapezoid_steps(uint32_t initial_rate, uint32_t final_rate, uint32_t nominal_rate,
+    uint32_t acceleration, uint32_t step_event_count, uint32_t &accelerate_steps, uint32_t &plateau_steps)
+{
+  if (acceleration == 0)
+      // Don't allow zero acceleration.
+      acceleration = 1;
+  uint32_t initial_rate_sqr  = initial_rate*initial_rate;
+  uint32_t nominal_rate_sqr  = nominal_rate*nominal_rate;
+  uint32_t final_rate_sqr    = final_rate*final_rate;
+  uint32_t acceleration_x2   = acceleration << 1;
+  // Steps to accelerate from the initial to the nominal rate, rounded up.
+  accelerate_steps           = (nominal_rate_sqr - initial_rate_sqr + acceleration_x2 - 1) / acceleration_x2;
+  // Steps to decelerate from the nominal to the final rate, rounded down.
+  uint32_t decelerate_steps  = (nominal_rate_sqr - final_rate_sqr) / acceleration_x2;
+  uint32_t accel_decel_steps = accelerate_steps + decelerate_steps;
+  // Size of Plateau of Nominal Rate.
+  plateau_steps              = 0;
+
+  // Is the Plateau of Nominal Rate smaller than nothing? That means no cruising, and we will
+  // have to use intersection_distance() to calculate when to abort acceleration and start braking
+  // in order to reach the final_rate exactly at the end of this block.
+  if (accel_decel_steps < step_event_count) {
+    plateau_steps = step_event_count - accel_decel_steps;
+  } else {
+    uint32_t acceleration_x4  = acceleration << 2;
+    // Avoid negative numbers
+    if (final_rate_sqr >= initial_rate_sqr) {
+        // Step of the intersection of the acceleration and deceleration ramps, rounded up.
+        accelerate_steps = final_rate_sqr - initial_rate_sqr + acceleration_x4 - 1;
+        if (step_event_count & 1)
+            accelerate_steps += acceleration_x2;
+        accelerate_steps /= acceleration_x4;
+        accelerate_steps += (step_event_count >> 1);
+        if (accelerate_steps > step_event_count)
+            accelerate_steps = step_event_count;
+    } else {
+        decelerate_steps = initial_rate_sqr - final_rate_sqr;
+        if (step_event_count & 1)
+            decelerate_steps += acceleration_x2;
+        decelerate_steps /= acceleration_x4;
+        decelerate_steps += (step_event_count >> 1);
+        if (decelerate_steps > step_event_count)
+            decelerate_steps = step_event_count;
+        accelerate_steps = step_event_count - decelerate_steps;
+    }
+  }
+}
+
@@ -0,0 +1,15 @@
+//! @file
+//! @brief Step domain trapezoid generator of the planner
+//!
+//! Splits a block of step_event_count steps into the acceleration, plateau and deceleration
+//! phases for the given initial, nominal and final step rates. Used by calculate_trapezoid_for_block().
+
+#ifndef TRAPEZOID_H
+#define TRAPEZOID_H
+
+#include <stdint.h>
+
+void trapezoid_steps(uint32_t initial_rate, uint32_t final_rate, uint32_t nominal_rate,
+    uint32_t acceleration, uint32_t step_event_count, uint32_t &accelerate_steps, uint32_t &plateau_steps);
+
+#endif /* TRAPEZOID_H */
@@ -4575,7 +4575,6 @@ static void lcd_fsensor_state_set()
 #endif //FILAMENT_SENSOR
 
 
-#if !SDSORT_USES_RAM
 void lcd_set_degree() {
 	lcd_set_custom_characters_degree();
 }
@@ -4583,7 +4582,6 @@ void lcd_set_degree() {
 void lcd_set_progress() {
 	lcd_set_custom_characters_progress();
 }
-#endif
 
 #if (LANG_MODE != 0)
 
@@ -7298,7 +7296,7 @@ void lcd_sdcard_menu()
   if (lcd_draw_update == 0 && LCD_CLICKED == 0)
     //_delay(100);
     return; // nothing to do (so don't thrash the SD card)
-  uint16_t fileCnt = card.getnrfilenames();
+  uint16_t fileCnt = card.getnrfilenames_cached();
 
 
   MENU_BEGIN();
@@ -7325,10 +7323,9 @@ void lcd_sdcard_menu()
 		#endif
 		i;*/
 		#ifdef SDCARD_SORT_ALPHA
-			if (sdSort == SD_SORT_NONE) card.getfilename(nr);
-			else card.getfilename_sorted(nr);
+			card.getfilename_cached(nr, sdSort != SD_SORT_NONE);
 		#else
-			 card.getfilename(nr);
+			card.getfilename_cached(nr, false);
 		#endif
 			
 		if (card.filenameIsDir)
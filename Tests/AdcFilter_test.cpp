@@ -0,0 +1,147 @@
+/**
+ * @file
+ */
+
+#include "catch.hpp"
+#include <stdlib.h>
+
+#include "../Firmware/adc_filter.h"
+
+TEST_CASE( "ADC median of three", "[adc]" )
+{
+    const uint16_t v[][3] = { {1, 2, 3}, {1, 3, 2}, {2, 1, 3}, {2, 3, 1}, {3, 1, 2}, {3, 2, 1}, {5, 5, 1}, {1, 5, 5}, {7, 7, 7} };
+    const uint16_t expected[] = { 2, 2, 2, 2, 2, 2, 5, 5, 7 };
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++ i)
+        CHECK(adc_median3(v[i][0], v[i][1], v[i][2]) == expected[i]);
+}
+
+TEST_CASE( "ADC filter without the median sums the groups", "[adc]" )
+{
+    adc_filter_t filter;
+    adc_filter_reset(&filter);
+    srand(3);
+    for (int group = 0; group < 10; ++ group) {
+        uint16_t sum = 0, value = 0;
+        for (int i = 0; i < 16; ++ i) {
+            const uint16_t sample = rand() % 1024;
+            sum += sample;
+            const uint8_t ready = adc_filter_add(&filter, sample, 16, &value);
+            REQUIRE(ready == (i == 15));
+        }
+        CHECK(value == sum);
+    }
+}
+
+TEST_CASE( "ADC filter partial sum", "[adc]" )
+{
+    adc_filter_t filter;
+    adc_filter_reset(&filter);
+    uint16_t value;
+    CHECK(adc_filter_partial(&filter, 16) == 0);
+    adc_filter_add(&filter, 500, 16, &value);
+    adc_filter_add(&filter, 502, 16, &value);
+    CHECK(adc_filter_partial(&filter, 16) == 501 * 16);
+}
+
+TEST_CASE( "ADC median filter rejects a burst", "[adc]" )
+{
+    adc_filter_t filter;
+    adc_median_t median;
+    adc_filter_reset(&filter);
+    adc_median_reset(&median);
+    uint16_t value = 0;
+    for (int cycle = 0; cycle < 3; ++ cycle) {
+        int outputs = 0;
+        for (int i = 0; i < 48; ++ i) {
+            // Spikes of the heater switching into the group 'cycle' of each cycle.
+            uint16_t sample = 600 + (i % 2);
+            if (i / 16 == cycle && i % 4 == 0)
+                sample = (cycle == 1) ? 0 : 1023;
+            uint16_t sum;
+            if (adc_filter_add(&filter, sample, 16, &sum))
+                outputs += adc_median_add(&median, sum, &value);
+        }
+        CHECK(outputs == 1);
+        // Sum of the clean samples 600, 601, 600, ...
+        CHECK(value == 16 * 600 + 8);
+    }
+}
+
+//! Run a cycle of the schedule.
+//! @return 1 if the credits are back at zero
+static bool schedule_cycle(uint8_t *slots, uint8_t slot_count, const uint8_t *conversions, uint8_t chan_count)
+{
+    int16_t credits[16] = {};
+    for (int slot = 0; slot < slot_count; ++ slot)
+        slots[slot] = adc_schedule_next(credits, slot_count, conversions, chan_count);
+    for (uint8_t i = 0; i < chan_count; ++ i)
+        if (credits[i] != 0)
+            return false;
+    return true;
+}
+
+// Schedule of the MK3 channels: hotend with the median, bed, 5 slow channels.
+TEST_CASE( "ADC schedule", "[adc]" )
+{
+    const uint8_t conversions[] = { 48, 4, 16, 4, 4, 4, 4 };
+    const uint8_t slot_count = 112;
+    uint8_t slots[slot_count];
+    REQUIRE(schedule_cycle(slots, slot_count, conversions, sizeof(conversions)));
+
+    int counts[sizeof(conversions)] = {};
+    int idle = 0;
+    // Hotend conversions in each third of the cycle, one median group each.
+    int thirds[3] = {};
+    for (int slot = 0; slot < slot_count; ++ slot) {
+        if (slots[slot] == ADC_SLOT_IDLE) {
+            ++ idle;
+            continue;
+        }
+        REQUIRE(slots[slot] < sizeof(conversions));
+        ++ counts[slots[slot]];
+        if (slots[slot] == 0)
+            ++ thirds[slot * 3 / slot_count];
+    }
+    for (size_t i = 0; i < sizeof(conversions); ++ i)
+        CHECK(counts[i] == conversions[i]);
+    CHECK(idle == 112 - 84);
+    for (int i = 0; i < 3; ++ i)
+        CHECK(thirds[i] == 16);
+
+    // The conversions of a channel are spread over the cycle.
+    for (uint8_t chan = 0; chan < sizeof(conversions); ++ chan) {
+        int last = -1, max_gap = 0;
+        for (int slot = 0; slot < slot_count; ++ slot)
+            if (slots[slot] == chan) {
+                if (last >= 0 && slot - last > max_gap)
+                    max_gap = slot - last;
+                last = slot;
+            }
+        INFO("channel " << int(chan));
+        CHECK(max_gap <= 2 * slot_count / conversions[chan]);
+    }
+}
+
+TEST_CASE( "ADC schedule of random rates repeats every cycle", "[adc]" )
+{
+    srand(5);
+    for (int i = 0; i < 1000; ++ i) {
+        const uint8_t slot_count = 2 + rand() % 254;
+        const uint8_t chan_count = 1 + rand() % 16;
+        uint8_t conversions[16];
+        int left = slot_count;
+        for (uint8_t chan = 0; chan < chan_count; ++ chan) {
+            conversions[chan] = rand() % (left + 1);
+            left -= conversions[chan];
+        }
+        uint8_t slots[255];
+        INFO("slots " << int(slot_count) << " channels " << int(chan_count));
+        REQUIRE(schedule_cycle(slots, slot_count, conversions, chan_count));
+        int counts[16] = {};
+        for (int slot = 0; slot < slot_count; ++ slot)
+            if (slots[slot] != ADC_SLOT_IDLE)
+                ++ counts[slots[slot]];
+        for (uint8_t chan = 0; chan < chan_count; ++ chan)
+            REQUIRE(counts[chan] == conversions[chan]);
+    }
+}
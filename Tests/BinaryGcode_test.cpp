@@ -0,0 +1,254 @@
+/**
+ * @file
+ */
+
+#include "catch.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmdqueue.h"
+#include "cardreader.h"
+#include "ultralcd.h"
+#include "MarlinSerial.h"
+
+//===========================================================================
+//=============================stubs of the rest of the firmware============
+//===========================================================================
+
+const char MSG_ERR_STOPPED[] PROGMEM = "";
+const char MSG_Enqueing[] PROGMEM = "";
+const char MSG_STOPPED[] PROGMEM = "";
+const char* lang_get_translation(const char *s) { return s; }
+
+bool Stopped;
+uint8_t farm_mode;
+bool isPrintPaused;
+unsigned int usb_printing_counter;
+LcdCommands lcd_commands_type = LcdCommands::Idle;
+bool saved_printing;
+unsigned long starttime;
+unsigned long stoptime;
+unsigned long pause_time;
+unsigned long total_filament_used;
+
+void FlushSerialRequestResend() {}
+void kill(const char *, unsigned char) {}
+void lcd_setstatus(const char *) {}
+void lcd_setstatuspgm(const char *) {}
+void process_commands() {}
+void prusa_statistics(int, uint8_t) {}
+void save_statistics(unsigned long, unsigned long) {}
+
+CardReader card;
+CardReader::CardReader() {}
+void CardReader::checkautostart(bool) {}
+void CardReader::printingHasFinished() {}
+int16_t SdBaseFile::read(void *, uint16_t) { return -1; }
+bool SdBaseFile::seekSet(uint32_t) { return false; }
+bool SdBaseFile::close() { return true; }
+
+
+static int8_t feed_frame(binary_gcode_decoder_t &decoder, const uint8_t *frame, uint8_t len, binary_gcode_packet_t &packet)
+{
+    int8_t status = BINARY_GCODE_BUSY;
+    for (uint8_t i = 0; i < len; ++ i) {
+        status = binary_gcode_feed(&decoder, frame[i], &packet);
+        if (i + 1 < len && status != BINARY_GCODE_BUSY)
+            return BINARY_GCODE_ERR_FRAME;
+    }
+    return status;
+}
+
+TEST_CASE( "Binary G-code CRC", "[binary_gcode]" )
+{
+    const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    CHECK(binary_gcode_crc(check, sizeof(check)) == 0x29B1);
+}
+
+TEST_CASE( "Binary G-code move round trip", "[binary_gcode]" )
+{
+    binary_gcode_decoder_t decoder = {};
+    binary_gcode_packet_t in = {}, out = {};
+    uint8_t frame[BINARY_GCODE_MAX_FRAME];
+
+    in.type = BINARY_GCODE_MOVE;
+    in.line = 0x1234;
+    in.mask = BINARY_GCODE_X | BINARY_GCODE_Y | BINARY_GCODE_Z | BINARY_GCODE_E | BINARY_GCODE_F;
+    in.value[0] = 125.375f;
+    in.value[1] = -0.5f;
+    in.value[2] = 0.2f;
+    in.value[3] = 0.03125f;
+    in.value[BINARY_GCODE_F_INDEX] = 3600.f;
+    uint8_t len = binary_gcode_encode(&in, frame);
+    REQUIRE(len == BINARY_GCODE_MAX_FRAME);
+    REQUIRE(feed_frame(decoder, frame, len, out) == BINARY_GCODE_DONE);
+    CHECK(out.type == BINARY_GCODE_MOVE);
+    CHECK(out.line == 0x1234);
+    CHECK(out.mask == in.mask);
+    for (int i = 0; i < 5; ++ i)
+        CHECK(out.value[i] == in.value[i]);
+    CHECK_FALSE(binary_gcode_busy(&decoder));
+
+    // Only the axes present in the mask are transferred.
+    in.mask = BINARY_GCODE_Y | BINARY_GCODE_E;
+    len = binary_gcode_encode(&in, frame);
+    REQUIRE(len == 4 + 1 + 2 * 4 + 2);
+    REQUIRE(feed_frame(decoder, frame, len, out) == BINARY_GCODE_DONE);
+    CHECK(out.mask == (BINARY_GCODE_Y | BINARY_GCODE_E));
+    CHECK(out.value[1] == -0.5f);
+    CHECK(out.value[3] == 0.03125f);
+}
+
+TEST_CASE( "Binary G-code temperature round trip", "[binary_gcode]" )
+{
+    binary_gcode_decoder_t decoder = {};
+    binary_gcode_packet_t in = {}, out = {};
+    uint8_t frame[BINARY_GCODE_MAX_FRAME];
+
+    in.type = BINARY_GCODE_TEMPERATURE;
+    in.line = 7;
+    in.mask = BINARY_GCODE_BED;
+    in.value[0] = 60;
+    const uint8_t len = binary_gcode_encode(&in, frame);
+    REQUIRE(len == 9);
+    REQUIRE(feed_frame(decoder, frame, len, out) == BINARY_GCODE_DONE);
+    CHECK(out.type == BINARY_GCODE_TEMPERATURE);
+    CHECK(out.line == 7);
+    CHECK(out.mask == BINARY_GCODE_BED);
+    CHECK(out.value[0] == 60.f);
+}
+
+TEST_CASE( "Binary G-code corrupted frames", "[binary_gcode]" )
+{
+    binary_gcode_decoder_t decoder = {};
+    binary_gcode_packet_t in = {}, out = {};
+    uint8_t frame[BINARY_GCODE_MAX_FRAME];
+
+    in.type = BINARY_GCODE_MOVE;
+    in.line = 1;
+    in.mask = BINARY_GCODE_X | BINARY_GCODE_F;
+    in.value[0] = 10.f;
+    in.value[BINARY_GCODE_F_INDEX] = 1200.f;
+    const uint8_t len = binary_gcode_encode(&in, frame);
+
+    frame[6] ^= 0x10;
+    CHECK(feed_frame(decoder, frame, len, out) == BINARY_GCODE_ERR_CRC);
+    CHECK_FALSE(binary_gcode_busy(&decoder));
+    frame[6] ^= 0x10;
+
+    // Unknown packet type
+    uint8_t bad_type[] = { BINARY_GCODE_SYNC, 9 };
+    CHECK(binary_gcode_feed(&decoder, bad_type[0], &out) == BINARY_GCODE_BUSY);
+    CHECK(binary_gcode_feed(&decoder, bad_type[1], &out) == BINARY_GCODE_ERR_FRAME);
+    CHECK_FALSE(binary_gcode_busy(&decoder));
+
+    // Undefined axis mask bits
+    uint8_t bad_mask[] = { BINARY_GCODE_SYNC, BINARY_GCODE_MOVE, 1, 0, 0x20 };
+    CHECK(feed_frame(decoder, bad_mask, sizeof(bad_mask), out) == BINARY_GCODE_ERR_FRAME);
+
+    // The decoder recovers with the next valid frame.
+    CHECK(feed_frame(decoder, frame, len, out) == BINARY_GCODE_DONE);
+    CHECK(out.value[0] == 10.f);
+}
+
+//! Enqueue a line received on the serial line, the way get_command() does it.
+static void receive_line(const char *line)
+{
+    for (const char *p = line; *p != 0; ++ p)
+        rx_buffer_store(*p);
+    rx_buffer_store('\n');
+    get_command();
+}
+
+TEST_CASE( "Binary G-code move parser matches the text parser", "[binary_gcode]" )
+{
+    static const char letters[] = "XYZEF";
+    static const char *const formats[] = { "%.3f", "%.5f", "%g", "%d", "%+.2f", "%.2e" };
+    srand(5);
+    cmdqueue_reset();
+    gcode_LastN = 0;
+    long line_number = 0;
+    int accepted = 0;
+    for (int line = 0; line < 20000; ++ line) {
+        char cmd[MAX_CMD_SIZE + 16];
+        int len = sprintf(cmd, "G%d", rand() % 2);
+        uint8_t used = 0;
+        for (int n = rand() % 6; n > 0; -- n) {
+            const int i = rand() % 5;
+            if (used & (1 << i))
+                continue;
+            used |= 1 << i;
+            if (rand() % 4)
+                cmd[len ++] = ' ';
+            cmd[len ++] = letters[i];
+            const char *fmt = formats[rand() % 6];
+            const double v = (rand() % 200001 - 100000) * 0.00037;
+            len += (fmt[1] == 'd') ? sprintf(cmd + len, fmt, int(v)) : sprintf(cmd + len, fmt, v);
+        }
+        cmd[len] = 0;
+        if (line % 3 == 0) {
+            // Numbered line with a checksum, stored with the '$' prefix.
+            char numbered[MAX_CMD_SIZE + 16];
+            len = snprintf(numbered, sizeof(numbered), "N%ld %s", ++ line_number, cmd);
+            REQUIRE(len + 4 < int(sizeof(numbered)));
+            uint8_t checksum = 0;
+            for (int i = 0; i < len; ++ i)
+                checksum ^= numbered[i];
+            snprintf(numbered + len, sizeof(numbered) - len, "*%d", checksum);
+            strcpy(cmd, numbered);
+        }
+        INFO(cmd);
+        receive_line(cmd);
+        REQUIRE(buflen == 1);
+
+        binary_gcode_packet_t packet = {};
+        const bool fast = cmdqueue_binary_take(packet);
+        if (fast) {
+            ++ accepted;
+            CHECK(packet.type == BINARY_GCODE_MOVE);
+        }
+        // The values, which get_coordinates() reads from the text.
+        for (int i = 0; i < 5; ++ i) {
+            const bool seen = code_seen(letters[i]);
+            if (fast) {
+                REQUIRE(((packet.mask & (1 << i)) != 0) == seen);
+                if (seen)
+                    REQUIRE(packet.value[i] == float(code_value()));
+            }
+        }
+        cmdqueue_pop_front();
+    }
+    // Only the lines with an exponent directly followed by another parameter are left to the text parser,
+    // like "F1.5e-03E2", where E is a parameter for code_seen() as well.
+    CHECK(accepted > 19000);
+}
+
+TEST_CASE( "Binary G-code move parser leaves the other commands to the text parser", "[binary_gcode]" )
+{
+    static const char *const rejected[] = {
+        "G1 X1E5",      // E would be a parameter for code_seen()
+        "G10",
+        "G1.5 X1",
+        "G2 X1 Y1 I1",
+        "G1 X1 X2",
+        "G1 X",
+        "G1 X1 S1",
+        "M117 G1",
+        "G1 X1 *12",
+        "G1 X1 ;",
+        "PRUSA G1",
+        "G28",
+    };
+    binary_gcode_packet_t packet;
+    for (const char *cmd : rejected)
+        CHECK_FALSE(binary_gcode_parse_move(cmd, &packet));
+
+    REQUIRE(binary_gcode_parse_move("$12 G1X10.5Y-3 F1200", &packet));
+    CHECK(packet.mask == (BINARY_GCODE_X | BINARY_GCODE_Y | BINARY_GCODE_F));
+    CHECK(packet.value[0] == 10.5f);
+    CHECK(packet.value[1] == -3.f);
+    CHECK(packet.value[BINARY_GCODE_F_INDEX] == 1200.f);
+    REQUIRE(binary_gcode_parse_move("G0", &packet));
+    CHECK(packet.mask == 0);
+}
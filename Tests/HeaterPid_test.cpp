@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @brief Closed loop step response of the float and the fixed point heater PID on a thermal model.
+ */
+
+#include "catch.hpp"
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+
+#include "../Firmware/heater_pid.h"
+
+// Temperature sampling period of the MK3S, PID_dT
+static const float dT = (16 * 10.0) / (16000000 / 64.0 / 256.0);
+static const float K1 = 0.95f;
+
+//! Heater block with the thermistor lagging behind it.
+struct Plant
+{
+    float power;        //!< W at the full PWM
+    float capacity;     //!< J/K
+    float loss;         //!< W/K
+    float sensor_lag;   //!< s
+    float ambient;
+    float block;
+    float sensor;
+
+    void step(int output, float dt)
+    {
+        // soft_pwm = output >> 1 out of 127
+        const float heat = power * (output >> 1) / 127.f;
+        const int n = 10;
+        for (int i = 0; i < n; ++ i) {
+            block += (heat - loss * (block - ambient)) / capacity * dt / n;
+            sensor += (block - sensor) / sensor_lag * dt / n;
+        }
+    }
+};
+
+struct Response
+{
+    float temperature[3000];
+    int output[3000];
+};
+
+//! The heater control of manage_heater() run for the cycles with a fan switched on at the half.
+template<typename Param, typename State, typename Update> static void run(const Plant &model, const Param &param, float target,
+    int cycles, Update update, Response &r)
+{
+    Plant plant = model;
+    State state = {};
+    for (int i = 0; i < cycles; ++ i) {
+        if (i == cycles / 2)
+            plant.loss *= 1.3f;
+        r.output[i] = update(&param, &state, target, plant.sensor);
+        r.temperature[i] = plant.sensor;
+        plant.step(r.output[i], dT);
+    }
+}
+
+static void compare(const Plant &plant, float kp, float ki, float kd, float output_max, float target, int cycles)
+{
+    REQUIRE(cycles <= 3000);
+    pid_param_t param;
+    pid_fixed_param_t fixed_param;
+    pid_set(&param, kp, ki * dT, kd / dT, K1, output_max, output_max);
+    pid_fixed_set(&fixed_param, kp, ki * dT, kd / dT, K1, output_max, output_max);
+    static Response r, f;
+    run<pid_param_t, pid_state_t>(plant, param, target, cycles,
+        [](const pid_param_t *p, pid_state_t *s, float t, float in) { return int(pid_update(p, s, t, in)); }, r);
+    run<pid_fixed_param_t, pid_fixed_state_t>(plant, fixed_param, target, cycles,
+        [](const pid_fixed_param_t *p, pid_fixed_state_t *s, float t, float in) {
+            return int(pid_fixed_update(p, s, int32_t(t) << 8, PID_FIXED(in))); }, f);
+
+    float max_diff = 0, overshoot = 0, fixed_overshoot = 0, settled = 0, fixed_settled = 0;
+    for (int i = 0; i < cycles; ++ i) {
+        max_diff = fmaxf(max_diff, fabsf(r.temperature[i] - f.temperature[i]));
+        overshoot = fmaxf(overshoot, r.temperature[i] - target);
+        fixed_overshoot = fmaxf(fixed_overshoot, f.temperature[i] - target);
+        // The last quarter before and after the fan is switched on
+        if ((i % (cycles / 2)) >= cycles * 3 / 8) {
+            settled = fmaxf(settled, fabsf(r.temperature[i] - target));
+            fixed_settled = fmaxf(fixed_settled, fabsf(f.temperature[i] - target));
+        }
+    }
+    INFO("max difference " << max_diff << " overshoot " << overshoot << " / " << fixed_overshoot
+        << " settled within " << settled << " / " << fixed_settled);
+    // The float controller itself is sane on the model.
+    CHECK(settled < 2.f);
+    // The fixed point one reproduces it.
+    CHECK(max_diff < 0.05f);
+    CHECK(fabsf(overshoot - fixed_overshoot) < 0.1f);
+    CHECK(fixed_settled < settled + 0.1f);
+
+    // Fed by the same measurements, the outputs differ by the rounding only: the truncation of the float output
+    // and the measurement rounded to 1/256 C times the gains.
+    pid_state_t state = {};
+    pid_fixed_state_t fixed_state = {};
+    int max_output_diff = 0;
+    for (int i = 0; i < cycles; ++ i) {
+        const int output = int(pid_update(&param, &state, target, r.temperature[i]));
+        const int fixed_output = pid_fixed_update(&fixed_param, &fixed_state, int32_t(target) << 8, PID_FIXED(r.temperature[i]));
+        max_output_diff = std::max(max_output_diff, abs(output - fixed_output));
+    }
+    CHECK(max_output_diff <= 2);
+}
+
+TEST_CASE( "Fixed point PID follows the float PID, hotend", "[heater_pid]" )
+{
+    // E3D v6 with the 40 W heater
+    Plant hotend = { 40.f, 13.f, 0.075f, 2.f, 25.f, 25.f, 25.f };
+    compare(hotend, 16.13f, 1.1625f, 56.23f, 255, 215, 2400);
+    compare(hotend, 16.13f, 1.1625f, 56.23f, 255, 280, 2400);
+    compare(hotend, 40.925f, 4.875f, 86.085f, 255, 170, 2400);
+}
+
+TEST_CASE( "Fixed point PID follows the float PID, bed", "[heater_pid]" )
+{
+    Plant bed = { 250.f, 400.f, 1.2f, 8.f, 25.f, 25.f, 25.f };
+    compare(bed, 126.13f, 4.30f, 924.76f, 255, 60, 3000);
+    compare(bed, 126.13f, 4.30f, 924.76f, 255, 90, 3000);
+}
+
+TEST_CASE( "Fixed point PID gain", "[heater_pid]" )
+{
+    const float gains[] = { 0.0001f, 0.19f, 0.5f, 1.f, 16.13f, 343.2f, 5645.f, 65535.f };
+    srand(3);
+    for (float gain : gains) {
+        const pid_gain_t g = pid_gain(gain);
+        CHECK(fabs(double(g.mantissa) * ldexp(1., g.shift - 16) - gain) <= gain * 1e-4);
+        for (int i = 0; i < 1000; ++ i) {
+            const int32_t x = (rand() % 2000001 - 1000000) * ((i & 1) ? 1 : 7);
+            const double exact = double(x) * g.mantissa * ldexp(1., g.shift - 16);
+            // Saturated above 2^30 before the multiplication.
+            if (fabs(ldexp(double(x), g.shift > 0 ? g.shift : 0)) < 1073741824.) {
+                INFO("gain " << gain << " x " << x);
+                CHECK(fabs(pid_mul(x, g) - exact) <= 1.);
+            }
+        }
+    }
+    CHECK(pid_gain(0).mantissa == 0);
+    CHECK(pid_mul(123456, pid_gain(0)) == 0);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @brief Serial RX ring fed by the RX interrupt of the simulated UART.
+ */
+
+#include "catch.hpp"
+
+#include "Marlin.h"
+#include "MarlinSerial.h"
+
+// The RX interrupt of the serial port, a plain function on the host.
+void M_USARTx_RX_vect();
+
+static void rx_reset()
+{
+    rx_buffer.head = 0;
+    rx_buffer.tail = 0;
+    rx_buffer.overflow = 0;
+    rx_buffer.overrun = 0;
+    selectedSerialPort = 0;
+}
+
+//! Receive a character by the RX interrupt.
+//! @param flags additional UCSR0A flags, FE0 for a framing error, DOR0 for a lost preceding character
+static void rx_isr(unsigned char c, uint8_t flags = 0)
+{
+    UCSR0A = _BV(UDRE0) | _BV(RXC0) | flags;
+    UDR0 = c;
+    M_USARTx_RX_vect();
+}
+
+TEST_CASE( "Serial RX ring keeps the order across the wrap", "[serial]" )
+{
+    rx_reset();
+    unsigned char sent = 0, received = 0;
+    // Chunks not dividing the ring size move the indices through all the positions.
+    for (int chunk = 0; chunk < 40; ++ chunk) {
+        const int n = 1 + (chunk * 37) % (RX_BUFFER_SIZE - 1);
+        for (int i = 0; i < n; ++ i)
+            rx_isr(sent ++);
+        REQUIRE(MarlinSerial::available() == n);
+        for (int i = 0; i < n; ++ i) {
+            REQUIRE(MarlinSerial::peek() == received);
+            REQUIRE(MarlinSerial::read() == received ++);
+        }
+        REQUIRE(MarlinSerial::available() == 0);
+        REQUIRE(MarlinSerial::read() == -1);
+        REQUIRE(MarlinSerial::peek() == -1);
+    }
+    CHECK(rx_buffer.overflow == 0);
+    CHECK(rx_buffer.overrun == 0);
+}
+
+TEST_CASE( "Serial RX ring counts the dropped characters", "[serial]" )
+{
+    rx_reset();
+    // One slot stays empty to tell the full ring from the empty one.
+    for (int i = 0; i < RX_BUFFER_SIZE + 10; ++ i)
+        rx_isr('a' + i % 26);
+    CHECK(MarlinSerial::available() == RX_BUFFER_SIZE - 1);
+    CHECK(rx_buffer.overflow == 11);
+    // The stored characters are not overwritten by the dropped ones.
+    for (int i = 0; i < RX_BUFFER_SIZE - 1; ++ i)
+        REQUIRE(MarlinSerial::read() == 'a' + i % 26);
+    CHECK(MarlinSerial::read() == -1);
+}
+
+TEST_CASE( "Serial RX interrupt counts the overruns and skips the framing errors", "[serial]" )
+{
+    rx_reset();
+    rx_isr('G');
+    rx_isr('1', _BV(DOR0));
+    rx_isr('x', _BV(FE0));
+    rx_isr(' ');
+    CHECK(rx_buffer.overrun == 1);
+    CHECK(rx_buffer.overflow == 0);
+    REQUIRE(MarlinSerial::available() == 3);
+    CHECK(MarlinSerial::read() == 'G');
+    CHECK(MarlinSerial::read() == '1');
+    CHECK(MarlinSerial::read() == ' ');
+}
+
+TEST_CASE( "Serial checkRx() polls the UART and flush() drops the received characters", "[serial]" )
+{
+    rx_reset();
+    UCSR0A = _BV(UDRE0);
+    UDR0 = 'M';
+    MarlinSerial::checkRx();
+    CHECK(MarlinSerial::available() == 0);
+    UCSR0A = _BV(UDRE0) | _BV(RXC0);
+    MarlinSerial::checkRx();
+    CHECK(MarlinSerial::available() == 1);
+    for (int i = 0; i < 5; ++ i)
+        rx_isr('0' + i);
+    CHECK(MarlinSerial::available() == 6);
+    MarlinSerial::flush();
+    CHECK(MarlinSerial::available() == 0);
+    rx_isr('N');
+    CHECK(MarlinSerial::read() == 'N');
+    // The characters for the other port are not stored.
+    selectedSerialPort = 1;
+    rx_isr('P');
+    CHECK(MarlinSerial::available() == 0);
+    selectedSerialPort = 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @brief Mesh bed leveling correction and the splitting of the moves at the mesh lines.
+ */
+
+#include "catch.hpp"
+#include <math.h>
+
+#include "mesh_bed_leveling.h"
+
+//! Deterministic pseudo random numbers.
+static uint32_t rnd(uint32_t &seed)
+{
+    seed = seed * 1103515245UL + 12345UL;
+    return seed >> 1;
+}
+
+//! @return uniform random number in <lo, hi>
+static float rnd_range(uint32_t &seed, float lo, float hi)
+{
+    return lo + (hi - lo) * float(rnd(seed) & 0xffff) / 65535.f;
+}
+
+static void random_mesh(uint32_t &seed)
+{
+    for (int iy = 0; iy < MESH_NUM_Y_POINTS; ++ iy)
+        for (int ix = 0; ix < MESH_NUM_X_POINTS; ++ ix)
+            mbl.set_z(ix, iy, rnd_range(seed, -0.5f, 0.5f));
+}
+
+//! get_z() before the cell coefficients were cached: the cell is found by the floor of a division
+//! and interpolated from the four mesh points.
+static float get_z_reference(float x, float y)
+{
+    int i = int(floor((x - MESH_MIN_X) / MESH_X_DIST));
+    float s;
+    if (i < 0) {
+        i = 0;
+        s = (x - MESH_MIN_X) / MESH_X_DIST;
+        if (s > 1.f)
+            s = 1.f;
+    } else if (i > MESH_NUM_X_POINTS - 2) {
+        i = MESH_NUM_X_POINTS - 2;
+        s = (x - mesh_bed_leveling::get_x(i)) / MESH_X_DIST;
+        if (s < 0)
+            s = 0;
+    } else {
+        s = (x - mesh_bed_leveling::get_x(i)) / MESH_X_DIST;
+        if (s < 0)
+            s = 0;
+        else if (s > 1.f)
+            s = 1.f;
+    }
+    int j = int(floor((y - MESH_MIN_Y) / MESH_Y_DIST));
+    float t;
+    if (j < 0) {
+        j = 0;
+        t = (y - MESH_MIN_Y) / MESH_Y_DIST;
+        if (t > 1.f)
+            t = 1.f;
+    } else if (j > MESH_NUM_Y_POINTS - 2) {
+        j = MESH_NUM_Y_POINTS - 2;
+        t = (y - mesh_bed_leveling::get_y(j)) / MESH_Y_DIST;
+        if (t < 0)
+            t = 0;
+    } else {
+        t = (y - mesh_bed_leveling::get_y(j)) / MESH_Y_DIST;
+        if (t < 0)
+            t = 0;
+        else if (t > 1.f)
+            t = 1.f;
+    }
+    const float z0 = (1.f - s) * mbl.z_values[j  ][i] + s * mbl.z_values[j  ][i+1];
+    const float z1 = (1.f - s) * mbl.z_values[j+1][i] + s * mbl.z_values[j+1][i+1];
+    return (1.f - t) * z0 + t * z1;
+}
+
+TEST_CASE( "MBL get_z matches the uncached interpolation", "[mbl]" )
+{
+    uint32_t seed = 1;
+    random_mesh(seed);
+    float x = MESH_MIN_X, y = MESH_MIN_Y;
+    for (int i = 0; i < 200000; ++ i) {
+        if (rnd(seed) % 4 == 0) {
+            // A jump anywhere in and around the mesh, usually to another cell.
+            x = rnd_range(seed, MESH_MIN_X - 20.f, MESH_MAX_X + 20.f);
+            y = rnd_range(seed, MESH_MIN_Y - 20.f, MESH_MAX_Y + 20.f);
+        } else {
+            // A short move, usually in the cached cell.
+            x += rnd_range(seed, -5.f, 5.f);
+            y += rnd_range(seed, -5.f, 5.f);
+        }
+        INFO("x " << x << " y " << y);
+        REQUIRE(fabs(mbl.get_z(x, y) - get_z_reference(x, y)) < 1e-5f);
+    }
+}
+
+TEST_CASE( "MBL get_z follows the modified mesh", "[mbl]" )
+{
+    uint32_t seed = 2;
+    random_mesh(seed);
+    const float x = mesh_bed_leveling::get_x(2) + 0.25f * MESH_X_DIST;
+    const float y = mesh_bed_leveling::get_y(3) + 0.5f * MESH_Y_DIST;
+    CHECK(fabs(mbl.get_z(x, y) - get_z_reference(x, y)) < 1e-5f);
+    // set_z() of a corner of the cached cell.
+    mbl.set_z(3, 4, 1.f);
+    CHECK(fabs(mbl.get_z(x, y) - get_z_reference(x, y)) < 1e-5f);
+    // Direct write, as G80 does, followed by the invalidation.
+    mbl.z_values[3][2] = -1.f;
+    mbl.invalidate_cell();
+    CHECK(fabs(mbl.get_z(x, y) - get_z_reference(x, y)) < 1e-5f);
+    mbl.reset();
+    CHECK(mbl.get_z(x, y) == 0.f);
+}
+
+//! Cell of a coordinate, the border cells extend beyond the mesh.
+static int cell(float p, float p_min, float p_dist, int n_points)
+{
+    const int i = int(floor((p - p_min) / p_dist));
+    return (i < 0) ? 0 : (i > n_points - 2) ? n_points - 2 : i;
+}
+
+static int cell_x(float x) { return cell(x, MESH_MIN_X, MESH_X_DIST, MESH_NUM_X_POINTS); }
+static int cell_y(float y) { return cell(y, MESH_MIN_Y, MESH_Y_DIST, MESH_NUM_Y_POINTS); }
+
+//! Check that each inner mesh line between p0 and p0 + dp is crossed at one of the split parameters t.
+//! @return number of the lines crossed
+static int check_lines_crossed(float p0, float dp, float p_min, float p_dist, int n_points, const float *t, uint8_t n)
+{
+    int crossed = 0;
+    for (int k = 1; k + 1 < n_points; ++ k) {
+        const float line = p_min + p_dist * k;
+        if ((p0 < line && line < p0 + dp) || (p0 + dp < line && line < p0)) {
+            ++ crossed;
+            // A crossing closer than 1e-4 to another one is merged with it.
+            const float tk = (line - p0) / dp;
+            bool found = false;
+            for (uint8_t i = 0; i < n; ++ i)
+                found |= fabs(t[i] - tk) < 1.5e-4f;
+            INFO("line " << line);
+            CHECK(found);
+        }
+    }
+    return crossed;
+}
+
+TEST_CASE( "MBL moves are split at the mesh lines", "[mbl]" )
+{
+    uint32_t seed = 3;
+    float t[mesh_bed_leveling::max_crossings];
+    for (int i = 0; i < 100000; ++ i) {
+        const float x = rnd_range(seed, MESH_MIN_X - 20.f, MESH_MAX_X + 20.f);
+        const float y = rnd_range(seed, MESH_MIN_Y - 20.f, MESH_MAX_Y + 20.f);
+        // Mostly short moves, some across the whole bed, some along an axis.
+        const float len = (rnd(seed) % 8 == 0) ? 300.f : 40.f;
+        float dx = rnd_range(seed, -len, len);
+        float dy = rnd_range(seed, -len, len);
+        if (rnd(seed) % 8 == 0)
+            ((rnd(seed) & 1) ? dx : dy) = 0.f;
+        const uint8_t n = mesh_bed_leveling::get_crossings(x, y, dx, dy, t);
+        INFO("x " << x << " y " << y << " dx " << dx << " dy " << dy);
+        REQUIRE(n <= int(mesh_bed_leveling::max_crossings));
+        const int crossed =
+            check_lines_crossed(x, dx, MESH_MIN_X, MESH_X_DIST, MESH_NUM_X_POINTS, t, n) +
+            check_lines_crossed(y, dy, MESH_MIN_Y, MESH_Y_DIST, MESH_NUM_Y_POINTS, t, n);
+        REQUIRE(n <= crossed);
+        // Each segment stays inside a single cell, checked just inside of its ends,
+        // beyond the crossings merged with them.
+        float t0 = 0.f;
+        for (uint8_t k = 0; k <= n; ++ k) {
+            const float t1 = (k < n) ? t[k] : 1.f;
+            REQUIRE(t1 > t0);
+            if (t1 - t0 > 5e-4f) {
+                const float ta = t0 + 2e-4f, tb = t1 - 2e-4f;
+                CHECK(cell_x(x + ta * dx) == cell_x(x + tb * dx));
+                CHECK(cell_y(y + ta * dy) == cell_y(y + tb * dy));
+            }
+            t0 = t1;
+        }
+    }
+}
+
+TEST_CASE( "MBL move through a mesh node is split once", "[mbl]" )
+{
+    float t[mesh_bed_leveling::max_crossings];
+    const float x = mesh_bed_leveling::get_x(2) - 0.5f * MESH_X_DIST;
+    const float y = mesh_bed_leveling::get_y(2) - 0.5f * MESH_Y_DIST;
+    REQUIRE(mesh_bed_leveling::get_crossings(x, y, MESH_X_DIST, MESH_Y_DIST, t) == 1);
+    CHECK(t[0] == Approx(0.5f));
+    // The same in the opposite direction.
+    REQUIRE(mesh_bed_leveling::get_crossings(x + MESH_X_DIST, y + MESH_Y_DIST, - MESH_X_DIST, - MESH_Y_DIST, t) == 1);
+    CHECK(t[0] == Approx(0.5f));
+    // No move, no split.
+    CHECK(mesh_bed_leveling::get_crossings(x, y, 0.f, 0.f, t) == 0);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file
+ */
+
+#include "catch.hpp"
+#include <math.h>
+
+// Thermistors of the MK3S variants
+#define TEMP_SENSOR_0 5
+#define TEMP_SENSOR_1 247
+#define TEMP_SENSOR_2 148
+#define TEMP_SENSOR_BED 1
+#define TEMP_SENSOR_AMBIENT 2000
+#include "../Firmware/thermistortables.h"
+#include "../Firmware/thermistor.h"
+
+// The linear scan formerly done by analog2temp().
+static float reference_celsius(int raw, const short (*tt)[2], uint8_t len)
+{
+    uint8_t i;
+    for (i = 1; i < len; i++)
+        if (tt[i][0] > raw)
+            return tt[i-1][1] + (raw - tt[i-1][0]) * (float)(tt[i][1] - tt[i-1][1]) / (float)(tt[i][0] - tt[i-1][0]);
+    return tt[i-1][1];
+}
+
+static void check_table(const short (*table)[2], const float *slope, uint8_t len)
+{
+    float max_error = 0;
+    for (int raw = -OVERSAMPLENR; raw <= 1024 * OVERSAMPLENR; ++ raw) {
+        const float error = fabsf(thermistor_celsius(raw, table, slope, len) - reference_celsius(raw, table, len));
+        if (error > max_error)
+            max_error = error;
+    }
+    CHECK(max_error < 0.001f);
+    // The table entries themselves are exact.
+    for (uint8_t i = 0; i < len; ++ i)
+        if (i + 1 == len || table[i + 1][0] != table[i][0])
+            CHECK(thermistor_celsius(table[i][0], table, slope, len) == table[i][1]);
+}
+
+#define CHECK_TABLE(table) do { \
+    static constexpr thermistor_slopes_t<sizeof(table) / sizeof(*table)> slopes = thermistor_make_slopes(table); \
+    static_assert(thermistor_sorted(table), #table " is not sorted by the raw value"); \
+    INFO(#table); \
+    check_table(table, slopes.slope, sizeof(table) / sizeof(*table)); \
+} while (0)
+
+TEST_CASE( "Thermistor conversion matches the linear table scan", "[thermistor]" )
+{
+    CHECK_TABLE(temptable_5);
+    CHECK_TABLE(temptable_247);
+    CHECK_TABLE(temptable_148);
+    CHECK_TABLE(temptable_1);
+    CHECK_TABLE(temptable_2000);
+}
+
+TEST_CASE( "Thermistor conversion out of the table range", "[thermistor]" )
+{
+    static constexpr thermistor_slopes_t<HEATER_0_TEMPTABLE_LEN> slopes = thermistor_make_slopes(HEATER_0_TEMPTABLE);
+    const short (*tt)[2] = HEATER_0_TEMPTABLE;
+    const uint8_t len = HEATER_0_TEMPTABLE_LEN;
+    // Extrapolated below the first entry, the last entry above the table.
+    CHECK(thermistor_celsius(tt[0][0] - 1, tt, slopes.slope, len) > tt[0][1]);
+    CHECK(thermistor_celsius(tt[len - 1][0] + 1, tt, slopes.slope, len) == tt[len - 1][1]);
+    CHECK(thermistor_celsius(32767, tt, slopes.slope, len) == tt[len - 1][1]);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @brief Tests of the step domain trapezoid generator of the planner.
+ */
+
+#include "catch.hpp"
+#include "../Firmware/trapezoid.h"
+
+//! Deterministic pseudo random numbers.
+static uint32_t rnd(uint32_t &seed)
+{
+    seed = seed * 1103515245UL + 12345UL;
+    return seed >> 1;
+}
+
+//! Reference trapezoid in 64 bits, written from the ramp formulas.
+static void trapezoid_reference(uint64_t initial_rate, uint64_t final_rate, uint64_t nominal_rate,
+    uint64_t acceleration, uint64_t n, uint64_t &accelerate_steps, uint64_t &plateau_steps)
+{
+    if (acceleration == 0)
+        acceleration = 1;
+    const uint64_t a2 = 2 * acceleration;
+    const uint64_t a4 = 4 * acceleration;
+    const uint64_t initial_sqr = initial_rate * initial_rate;
+    const uint64_t final_sqr = final_rate * final_rate;
+    const uint64_t nominal_sqr = nominal_rate * nominal_rate;
+    // ceil((v_nominal^2 - v_initial^2) / 2a), floor((v_nominal^2 - v_final^2) / 2a)
+    accelerate_steps = (nominal_sqr - initial_sqr + a2 - 1) / a2;
+    uint64_t decelerate_steps = (nominal_sqr - final_sqr) / a2;
+    plateau_steps = 0;
+    if (accelerate_steps + decelerate_steps < n) {
+        plateau_steps = n - accelerate_steps - decelerate_steps;
+    } else if (final_sqr >= initial_sqr) {
+        // Intersection of the ramps: (2 a n - v_initial^2 + v_final^2) / 4a, rounded up.
+        accelerate_steps = n / 2 + (final_sqr - initial_sqr + (n & 1) * a2 + a4 - 1) / a4;
+        if (accelerate_steps > n)
+            accelerate_steps = n;
+    } else {
+        decelerate_steps = n / 2 + (initial_sqr - final_sqr + (n & 1) * a2) / a4;
+        if (decelerate_steps > n)
+            decelerate_steps = n;
+        accelerate_steps = n - decelerate_steps;
+    }
+}
+
+static void check_trapezoid(uint32_t initial_rate, uint32_t final_rate, uint32_t nominal_rate,
+    uint32_t acceleration, uint32_t step_event_count)
+{
+    uint32_t accelerate_steps, plateau_steps;
+    uint64_t accelerate_steps_ref, plateau_steps_ref;
+    trapezoid_steps(initial_rate, final_rate, nominal_rate, acceleration, step_event_count, accelerate_steps, plateau_steps);
+    trapezoid_reference(initial_rate, final_rate, nominal_rate, acceleration, step_event_count, accelerate_steps_ref, plateau_steps_ref);
+    INFO("initial " << initial_rate << " final " << final_rate << " nominal " << nominal_rate
+        << " acceleration " << acceleration << " steps " << step_event_count);
+    REQUIRE(accelerate_steps == accelerate_steps_ref);
+    REQUIRE(plateau_steps == plateau_steps_ref);
+    REQUIRE(uint64_t(accelerate_steps) + plateau_steps <= step_event_count);
+}
+
+TEST_CASE("Trapezoid edge cases", "[trapezoid]")
+{
+    const uint32_t rates[] = { 120, 121, 1000, 9999, 10000, 20001, 39999, 40000 };
+    const uint32_t accelerations[] = { 0, 1, 2, 3, 100, 1250, 125000, 1400000, 2000000 };
+    const uint32_t steps[] = { 1, 2, 3, 100, 32767, 32768, 1000000 };
+    for (uint32_t nominal : rates)
+        for (uint32_t initial : rates)
+            for (uint32_t final : rates)
+                if (initial <= nominal && final <= nominal)
+                    for (uint32_t acceleration : accelerations)
+                        for (uint32_t n : steps)
+                            check_trapezoid(initial, final, nominal, acceleration, n);
+}
+
+TEST_CASE("Trapezoid random blocks", "[trapezoid]")
+{
+    uint32_t seed = 1;
+    for (uint32_t i = 0; i < 200000; ++ i) {
+        uint32_t nominal = 120 + rnd(seed) % (40000 - 120 + 1);
+        uint32_t initial = 120 + rnd(seed) % (nominal - 120 + 1);
+        uint32_t final = 120 + rnd(seed) % (nominal - 120 + 1);
+        uint32_t acceleration = 1 + rnd(seed) % ((rnd(seed) & 1) ? 5000 : 2000000);
+        uint32_t n = 1 + rnd(seed) % ((rnd(seed) & 1) ? 200 : 1000000);
+        check_trapezoid(initial, final, nominal, acceleration, n);
+    }
+}
+
+TEST_CASE("Trapezoid symmetric block", "[trapezoid]")
+{
+    uint32_t accelerate_steps, plateau_steps;
+    // 10000 steps/s^2 from 1000 to 11000 steps/s and back takes 6000 steps each way.
+    trapezoid_steps(1000, 1000, 11000, 10000, 20000, accelerate_steps, plateau_steps);
+    REQUIRE(accelerate_steps == 6000);
+    REQUIRE(plateau_steps == 8000);
+    // Too short for the plateau, the ramps meet in the middle.
+    trapezoid_steps(1000, 1000, 11000, 10000, 1000, accelerate_steps, plateau_steps);
+    REQUIRE(accelerate_steps == 500);
+    REQUIRE(plateau_steps == 0);
+}
@@ -0,0 +1,9 @@
+/**
+ * @file
+ * @brief Printer variant selection for the simulation targets.
+ *
+ * The build normally copies one of Firmware/variants/ to Firmware/Configuration_prusa.h.
+ * The simulators model the MK3S.
+ */
+
+#include "variants/1_75mm_MK3S-EINSy10a-E3Dv6full.h"
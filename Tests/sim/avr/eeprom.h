@@ -0,0 +1,37 @@
+/**
+ * @file
+ * @brief Host replacement of avr/eeprom.h for the simulation targets.
+ *
+ * The EEPROM is emulated by a RAM array defined in sim_avr.cpp.
+ */
+
+#ifndef TESTS_SIM_AVR_EEPROM_H_
+#define TESTS_SIM_AVR_EEPROM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define EEMEM
+
+extern uint8_t sim_eeprom[4096];
+
+static inline uint8_t eeprom_read_byte(const uint8_t *addr) { return sim_eeprom[(uintptr_t)addr & 0x0FFF]; }
+static inline uint16_t eeprom_read_word(const uint16_t *addr) { uint16_t v; memcpy(&v, sim_eeprom + ((uintptr_t)addr & 0x0FFF), sizeof(v)); return v; }
+static inline uint32_t eeprom_read_dword(const uint32_t *addr) { uint32_t v; memcpy(&v, sim_eeprom + ((uintptr_t)addr & 0x0FFF), sizeof(v)); return v; }
+static inline float eeprom_read_float(const float *addr) { float v; memcpy(&v, sim_eeprom + ((uintptr_t)addr & 0x0FFF), sizeof(v)); return v; }
+static inline void eeprom_read_block(void *dst, const void *src, size_t n) { memcpy(dst, sim_eeprom + ((uintptr_t)src & 0x0FFF), n); }
+
+static inline void eeprom_write_byte(uint8_t *addr, uint8_t v) { sim_eeprom[(uintptr_t)addr & 0x0FFF] = v; }
+static inline void eeprom_write_word(uint16_t *addr, uint16_t v) { memcpy(sim_eeprom + ((uintptr_t)addr & 0x0FFF), &v, sizeof(v)); }
+static inline void eeprom_write_dword(uint32_t *addr, uint32_t v) { memcpy(sim_eeprom + ((uintptr_t)addr & 0x0FFF), &v, sizeof(v)); }
+static inline void eeprom_write_float(float *addr, float v) { memcpy(sim_eeprom + ((uintptr_t)addr & 0x0FFF), &v, sizeof(v)); }
+static inline void eeprom_write_block(const void *src, void *dst, size_t n) { memcpy(sim_eeprom + ((uintptr_t)dst & 0x0FFF), src, n); }
+
+#define eeprom_update_byte eeprom_write_byte
+#define eeprom_update_word eeprom_write_word
+#define eeprom_update_dword eeprom_write_dword
+#define eeprom_update_float eeprom_write_float
+#define eeprom_update_block eeprom_write_block
+
+#endif /* TESTS_SIM_AVR_EEPROM_H_ */
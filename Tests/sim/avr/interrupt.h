@@ -0,0 +1,18 @@
+/**
+ * @file
+ * @brief Host replacement of avr/interrupt.h for the simulation targets.
+ *
+ * An interrupt service routine becomes a plain function named after its vector,
+ * so the simulator may invoke e.g. TIMER1_COMPA_vect() directly.
+ */
+
+#ifndef TESTS_SIM_AVR_INTERRUPT_H_
+#define TESTS_SIM_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define ISR(vector, ...) void vector(void)
+#define sei() (SREG |= 0x80)
+#define cli() (SREG &= ~0x80)
+
+#endif /* TESTS_SIM_AVR_INTERRUPT_H_ */
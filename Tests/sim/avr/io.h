@@ -0,0 +1,1074 @@
+/**
+ * @file
+ * @brief Host replacement of avr/io.h for the simulation targets.
+ *
+ * The special function registers of the ATmega2560 are plain memory cells here,
+ * so the firmware register access compiles unchanged and the simulator
+ * may inspect or drive them (timer compare values, ADC results, port pins).
+ */
+
+#ifndef TESTS_SIM_AVR_IO_H_
+#define TESTS_SIM_AVR_IO_H_
+
+#include <stdint.h>
+#include <avr/sfr_defs.h>
+
+#ifndef __AVR_ATmega2560__
+#define __AVR_ATmega2560__
+#endif
+
+#define RAMEND 0x21FF
+#define E2END 0x0FFF
+#define FLASHEND 0x3FFFF
+
+//! 8bit special function registers.
+#define SIM_SFR8_LIST(X) \
+	X(PINA) \
+	X(DDRA) \
+	X(PORTA) \
+	X(PINB) \
+	X(DDRB) \
+	X(PORTB) \
+	X(PINC) \
+	X(DDRC) \
+	X(PORTC) \
+	X(PIND) \
+	X(DDRD) \
+	X(PORTD) \
+	X(PINE) \
+	X(DDRE) \
+	X(PORTE) \
+	X(PINF) \
+	X(DDRF) \
+	X(PORTF) \
+	X(PING) \
+	X(DDRG) \
+	X(PORTG) \
+	X(PINH) \
+	X(DDRH) \
+	X(PORTH) \
+	X(PINJ) \
+	X(DDRJ) \
+	X(PORTJ) \
+	X(PINK) \
+	X(DDRK) \
+	X(PORTK) \
+	X(PINL) \
+	X(DDRL) \
+	X(PORTL) \
+	X(SREG) \
+	X(SPL) \
+	X(SPH) \
+	X(MCUSR) \
+	X(WDTCSR) \
+	X(EICRA) \
+	X(EICRB) \
+	X(EIMSK) \
+	X(EIFR) \
+	X(PCICR) \
+	X(PCMSK0) \
+	X(PCMSK1) \
+	X(PCMSK2) \
+	X(PCIFR) \
+	X(TCCR0A) \
+	X(TCCR0B) \
+	X(TCNT0) \
+	X(OCR0A) \
+	X(OCR0B) \
+	X(TIMSK0) \
+	X(TIFR0) \
+	X(TCCR1A) \
+	X(TCCR1B) \
+	X(TCCR1C) \
+	X(TIMSK1) \
+	X(TIFR1) \
+	X(TCCR2A) \
+	X(TCCR2B) \
+	X(TCNT2) \
+	X(OCR2A) \
+	X(OCR2B) \
+	X(TIMSK2) \
+	X(TIFR2) \
+	X(ASSR) \
+	X(TCCR3A) \
+	X(TCCR3B) \
+	X(TCCR3C) \
+	X(TIMSK3) \
+	X(TIFR3) \
+	X(TCCR4A) \
+	X(TCCR4B) \
+	X(TCCR4C) \
+	X(TIMSK4) \
+	X(TIFR4) \
+	X(TCCR5A) \
+	X(TCCR5B) \
+	X(TCCR5C) \
+	X(TIMSK5) \
+	X(TIFR5) \
+	X(ADMUX) \
+	X(ADCSRA) \
+	X(ADCSRB) \
+	X(ADCL) \
+	X(ADCH) \
+	X(DIDR0) \
+	X(DIDR1) \
+	X(DIDR2) \
+	X(SPCR) \
+	X(SPSR) \
+	X(SPDR) \
+	X(TWBR) \
+	X(TWSR) \
+	X(TWAR) \
+	X(TWDR) \
+	X(TWCR) \
+	X(TWAMR) \
+	X(GPIOR0) \
+	X(GPIOR1) \
+	X(GPIOR2) \
+	X(EECR) \
+	X(EEDR) \
+	X(EEARL) \
+	X(EEARH) \
+	X(SMCR) \
+	X(PRR0) \
+	X(PRR1) \
+	X(CLKPR) \
+	X(OSCCAL) \
+	X(RAMPZ) \
+	X(EIND) \
+	X(UCSR0A) \
+	X(UCSR0B) \
+	X(UCSR0C) \
+	X(UDR0) \
+	X(UBRR0H) \
+	X(UBRR0L) \
+	X(UCSR1A) \
+	X(UCSR1B) \
+	X(UCSR1C) \
+	X(UDR1) \
+	X(UBRR1H) \
+	X(UBRR1L) \
+	X(UCSR2A) \
+	X(UCSR2B) \
+	X(UCSR2C) \
+	X(UDR2) \
+	X(UBRR2H) \
+	X(UBRR2L) \
+	X(UCSR3A) \
+	X(UCSR3B) \
+	X(UCSR3C) \
+	X(UDR3) \
+	X(UBRR3H) \
+	X(UBRR3L)
+
+//! 16bit special function registers.
+#define SIM_SFR16_LIST(X) \
+	X(TCNT1) \
+	X(OCR1A) \
+	X(OCR1B) \
+	X(OCR1C) \
+	X(ICR1) \
+	X(TCNT3) \
+	X(OCR3A) \
+	X(OCR3B) \
+	X(OCR3C) \
+	X(ICR3) \
+	X(TCNT4) \
+	X(OCR4A) \
+	X(OCR4B) \
+	X(OCR4C) \
+	X(ICR4) \
+	X(TCNT5) \
+	X(OCR5A) \
+	X(OCR5B) \
+	X(OCR5C) \
+	X(ICR5) \
+	X(ADC) \
+	X(ADCW) \
+	X(UBRR0) \
+	X(UBRR1) \
+	X(UBRR2) \
+	X(UBRR3) \
+	X(EEAR)
+
+#define SIM_SFR8_DECLARE(reg) extern volatile uint8_t sim_##reg;
+#define SIM_SFR16_DECLARE(reg) extern volatile uint16_t sim_##reg;
+SIM_SFR8_LIST(SIM_SFR8_DECLARE)
+SIM_SFR16_LIST(SIM_SFR16_DECLARE)
+
+// The register names have to be macros, the firmware probes them with #if defined().
+#define PINA sim_PINA
+#define DDRA sim_DDRA
+#define PORTA sim_PORTA
+#define PINB sim_PINB
+#define DDRB sim_DDRB
+#define PORTB sim_PORTB
+#define PINC sim_PINC
+#define DDRC sim_DDRC
+#define PORTC sim_PORTC
+#define PIND sim_PIND
+#define DDRD sim_DDRD
+#define PORTD sim_PORTD
+#define PINE sim_PINE
+#define DDRE sim_DDRE
+#define PORTE sim_PORTE
+#define PINF sim_PINF
+#define DDRF sim_DDRF
+#define PORTF sim_PORTF
+#define PING sim_PING
+#define DDRG sim_DDRG
+#define PORTG sim_PORTG
+#define PINH sim_PINH
+#define DDRH sim_DDRH
+#define PORTH sim_PORTH
+#define PINJ sim_PINJ
+#define DDRJ sim_DDRJ
+#define PORTJ sim_PORTJ
+#define PINK sim_PINK
+#define DDRK sim_DDRK
+#define PORTK sim_PORTK
+#define PINL sim_PINL
+#define DDRL sim_DDRL
+#define PORTL sim_PORTL
+#define SREG sim_SREG
+#define SPL sim_SPL
+#define SPH sim_SPH
+#define MCUSR sim_MCUSR
+#define WDTCSR sim_WDTCSR
+#define EICRA sim_EICRA
+#define EICRB sim_EICRB
+#define EIMSK sim_EIMSK
+#define EIFR sim_EIFR
+#define PCICR sim_PCICR
+#define PCMSK0 sim_PCMSK0
+#define PCMSK1 sim_PCMSK1
+#define PCMSK2 sim_PCMSK2
+#define PCIFR sim_PCIFR
+#define TCCR0A sim_TCCR0A
+#define TCCR0B sim_TCCR0B
+#define TCNT0 sim_TCNT0
+#define OCR0A sim_OCR0A
+#define OCR0B sim_OCR0B
+#define TIMSK0 sim_TIMSK0
+#define TIFR0 sim_TIFR0
+#define TCCR1A sim_TCCR1A
+#define TCCR1B sim_TCCR1B
+#define TCCR1C sim_TCCR1C
+#define TIMSK1 sim_TIMSK1
+#define TIFR1 sim_TIFR1
+#define TCCR2A sim_TCCR2A
+#define TCCR2B sim_TCCR2B
+#define TCNT2 sim_TCNT2
+#define OCR2A sim_OCR2A
+#define OCR2B sim_OCR2B
+#define TIMSK2 sim_TIMSK2
+#define TIFR2 sim_TIFR2
+#define ASSR sim_ASSR
+#define TCCR3A sim_TCCR3A
+#define TCCR3B sim_TCCR3B
+#define TCCR3C sim_TCCR3C
+#define TIMSK3 sim_TIMSK3
+#define TIFR3 sim_TIFR3
+#define TCCR4A sim_TCCR4A
+#define TCCR4B sim_TCCR4B
+#define TCCR4C sim_TCCR4C
+#define TIMSK4 sim_TIMSK4
+#define TIFR4 sim_TIFR4
+#define TCCR5A sim_TCCR5A
+#define TCCR5B sim_TCCR5B
+#define TCCR5C sim_TCCR5C
+#define TIMSK5 sim_TIMSK5
+#define TIFR5 sim_TIFR5
+#define ADMUX sim_ADMUX
+#define ADCSRA sim_ADCSRA
+#define ADCSRB sim_ADCSRB
+#define ADCL sim_ADCL
+#define ADCH sim_ADCH
+#define DIDR0 sim_DIDR0
+#define DIDR1 sim_DIDR1
+#define DIDR2 sim_DIDR2
+#define SPCR sim_SPCR
+#define SPSR sim_SPSR
+#define SPDR sim_SPDR
+#define TWBR sim_TWBR
+#define TWSR sim_TWSR
+#define TWAR sim_TWAR
+#define TWDR sim_TWDR
+#define TWCR sim_TWCR
+#define TWAMR sim_TWAMR
+#define GPIOR0 sim_GPIOR0
+#define GPIOR1 sim_GPIOR1
+#define GPIOR2 sim_GPIOR2
+#define EECR sim_EECR
+#define EEDR sim_EEDR
+#define EEARL sim_EEARL
+#define EEARH sim_EEARH
+#define SMCR sim_SMCR
+#define PRR0 sim_PRR0
+#define PRR1 sim_PRR1
+#define CLKPR sim_CLKPR
+#define OSCCAL sim_OSCCAL
+#define RAMPZ sim_RAMPZ
+#define EIND sim_EIND
+#define UCSR0A sim_UCSR0A
+#define UCSR0B sim_UCSR0B
+#define UCSR0C sim_UCSR0C
+#define UDR0 sim_UDR0
+#define UBRR0H sim_UBRR0H
+#define UBRR0L sim_UBRR0L
+#define UCSR1A sim_UCSR1A
+#define UCSR1B sim_UCSR1B
+#define UCSR1C sim_UCSR1C
+#define UDR1 sim_UDR1
+#define UBRR1H sim_UBRR1H
+#define UBRR1L sim_UBRR1L
+#define UCSR2A sim_UCSR2A
+#define UCSR2B sim_UCSR2B
+#define UCSR2C sim_UCSR2C
+#define UDR2 sim_UDR2
+#define UBRR2H sim_UBRR2H
+#define UBRR2L sim_UBRR2L
+#define UCSR3A sim_UCSR3A
+#define UCSR3B sim_UCSR3B
+#define UCSR3C sim_UCSR3C
+#define UDR3 sim_UDR3
+#define UBRR3H sim_UBRR3H
+#define UBRR3L sim_UBRR3L
+#define TCNT1 sim_TCNT1
+#define OCR1A sim_OCR1A
+#define OCR1B sim_OCR1B
+#define OCR1C sim_OCR1C
+#define ICR1 sim_ICR1
+#define TCNT3 sim_TCNT3
+#define OCR3A sim_OCR3A
+#define OCR3B sim_OCR3B
+#define OCR3C sim_OCR3C
+#define ICR3 sim_ICR3
+#define TCNT4 sim_TCNT4
+#define OCR4A sim_OCR4A
+#define OCR4B sim_OCR4B
+#define OCR4C sim_OCR4C
+#define ICR4 sim_ICR4
+#define TCNT5 sim_TCNT5
+#define OCR5A sim_OCR5A
+#define OCR5B sim_OCR5B
+#define OCR5C sim_OCR5C
+#define ICR5 sim_ICR5
+#define ADC sim_ADC
+#define ADCW sim_ADCW
+#define UBRR0 sim_UBRR0
+#define UBRR1 sim_UBRR1
+#define UBRR2 sim_UBRR2
+#define UBRR3 sim_UBRR3
+#define EEAR sim_EEAR
+
+// Register bit positions.
+#define PA0 0
+#define PINA0 0
+#define DDA0 0
+#define PORTA0 0
+#define PA1 1
+#define PINA1 1
+#define DDA1 1
+#define PORTA1 1
+#define PA2 2
+#define PINA2 2
+#define DDA2 2
+#define PORTA2 2
+#define PA3 3
+#define PINA3 3
+#define DDA3 3
+#define PORTA3 3
+#define PA4 4
+#define PINA4 4
+#define DDA4 4
+#define PORTA4 4
+#define PA5 5
+#define PINA5 5
+#define DDA5 5
+#define PORTA5 5
+#define PA6 6
+#define PINA6 6
+#define DDA6 6
+#define PORTA6 6
+#define PA7 7
+#define PINA7 7
+#define DDA7 7
+#define PORTA7 7
+#define PB0 0
+#define PINB0 0
+#define DDB0 0
+#define PORTB0 0
+#define PB1 1
+#define PINB1 1
+#define DDB1 1
+#define PORTB1 1
+#define PB2 2
+#define PINB2 2
+#define DDB2 2
+#define PORTB2 2
+#define PB3 3
+#define PINB3 3
+#define DDB3 3
+#define PORTB3 3
+#define PB4 4
+#define PINB4 4
+#define DDB4 4
+#define PORTB4 4
+#define PB5 5
+#define PINB5 5
+#define DDB5 5
+#define PORTB5 5
+#define PB6 6
+#define PINB6 6
+#define DDB6 6
+#define PORTB6 6
+#define PB7 7
+#define PINB7 7
+#define DDB7 7
+#define PORTB7 7
+#define PC0 0
+#define PINC0 0
+#define DDC0 0
+#define PORTC0 0
+#define PC1 1
+#define PINC1 1
+#define DDC1 1
+#define PORTC1 1
+#define PC2 2
+#define PINC2 2
+#define DDC2 2
+#define PORTC2 2
+#define PC3 3
+#define PINC3 3
+#define DDC3 3
+#define PORTC3 3
+#define PC4 4
+#define PINC4 4
+#define DDC4 4
+#define PORTC4 4
+#define PC5 5
+#define PINC5 5
+#define DDC5 5
+#define PORTC5 5
+#define PC6 6
+#define PINC6 6
+#define DDC6 6
+#define PORTC6 6
+#define PC7 7
+#define PINC7 7
+#define DDC7 7
+#define PORTC7 7
+#define PD0 0
+#define PIND0 0
+#define DDD0 0
+#define PORTD0 0
+#define PD1 1
+#define PIND1 1
+#define DDD1 1
+#define PORTD1 1
+#define PD2 2
+#define PIND2 2
+#define DDD2 2
+#define PORTD2 2
+#define PD3 3
+#define PIND3 3
+#define DDD3 3
+#define PORTD3 3
+#define PD4 4
+#define PIND4 4
+#define DDD4 4
+#define PORTD4 4
+#define PD5 5
+#define PIND5 5
+#define DDD5 5
+#define PORTD5 5
+#define PD6 6
+#define PIND6 6
+#define DDD6 6
+#define PORTD6 6
+#define PD7 7
+#define PIND7 7
+#define DDD7 7
+#define PORTD7 7
+#define PE0 0
+#define PINE0 0
+#define DDE0 0
+#define PORTE0 0
+#define PE1 1
+#define PINE1 1
+#define DDE1 1
+#define PORTE1 1
+#define PE2 2
+#define PINE2 2
+#define DDE2 2
+#define PORTE2 2
+#define PE3 3
+#define PINE3 3
+#define DDE3 3
+#define PORTE3 3
+#define PE4 4
+#define PINE4 4
+#define DDE4 4
+#define PORTE4 4
+#define PE5 5
+#define PINE5 5
+#define DDE5 5
+#define PORTE5 5
+#define PE6 6
+#define PINE6 6
+#define DDE6 6
+#define PORTE6 6
+#define PE7 7
+#define PINE7 7
+#define DDE7 7
+#define PORTE7 7
+#define PF0 0
+#define PINF0 0
+#define DDF0 0
+#define PORTF0 0
+#define PF1 1
+#define PINF1 1
+#define DDF1 1
+#define PORTF1 1
+#define PF2 2
+#define PINF2 2
+#define DDF2 2
+#define PORTF2 2
+#define PF3 3
+#define PINF3 3
+#define DDF3 3
+#define PORTF3 3
+#define PF4 4
+#define PINF4 4
+#define DDF4 4
+#define PORTF4 4
+#define PF5 5
+#define PINF5 5
+#define DDF5 5
+#define PORTF5 5
+#define PF6 6
+#define PINF6 6
+#define DDF6 6
+#define PORTF6 6
+#define PF7 7
+#define PINF7 7
+#define DDF7 7
+#define PORTF7 7
+#define PG0 0
+#define PING0 0
+#define DDG0 0
+#define PORTG0 0
+#define PG1 1
+#define PING1 1
+#define DDG1 1
+#define PORTG1 1
+#define PG2 2
+#define PING2 2
+#define DDG2 2
+#define PORTG2 2
+#define PG3 3
+#define PING3 3
+#define DDG3 3
+#define PORTG3 3
+#define PG4 4
+#define PING4 4
+#define DDG4 4
+#define PORTG4 4
+#define PG5 5
+#define PING5 5
+#define DDG5 5
+#define PORTG5 5
+#define PG6 6
+#define PING6 6
+#define DDG6 6
+#define PORTG6 6
+#define PG7 7
+#define PING7 7
+#define DDG7 7
+#define PORTG7 7
+#define PH0 0
+#define PINH0 0
+#define DDH0 0
+#define PORTH0 0
+#define PH1 1
+#define PINH1 1
+#define DDH1 1
+#define PORTH1 1
+#define PH2 2
+#define PINH2 2
+#define DDH2 2
+#define PORTH2 2
+#define PH3 3
+#define PINH3 3
+#define DDH3 3
+#define PORTH3 3
+#define PH4 4
+#define PINH4 4
+#define DDH4 4
+#define PORTH4 4
+#define PH5 5
+#define PINH5 5
+#define DDH5 5
+#define PORTH5 5
+#define PH6 6
+#define PINH6 6
+#define DDH6 6
+#define PORTH6 6
+#define PH7 7
+#define PINH7 7
+#define DDH7 7
+#define PORTH7 7
+#define PJ0 0
+#define PINJ0 0
+#define DDJ0 0
+#define PORTJ0 0
+#define PJ1 1
+#define PINJ1 1
+#define DDJ1 1
+#define PORTJ1 1
+#define PJ2 2
+#define PINJ2 2
+#define DDJ2 2
+#define PORTJ2 2
+#define PJ3 3
+#define PINJ3 3
+#define DDJ3 3
+#define PORTJ3 3
+#define PJ4 4
+#define PINJ4 4
+#define DDJ4 4
+#define PORTJ4 4
+#define PJ5 5
+#define PINJ5 5
+#define DDJ5 5
+#define PORTJ5 5
+#define PJ6 6
+#define PINJ6 6
+#define DDJ6 6
+#define PORTJ6 6
+#define PJ7 7
+#define PINJ7 7
+#define DDJ7 7
+#define PORTJ7 7
+#define PK0 0
+#define PINK0 0
+#define DDK0 0
+#define PORTK0 0
+#define PK1 1
+#define PINK1 1
+#define DDK1 1
+#define PORTK1 1
+#define PK2 2
+#define PINK2 2
+#define DDK2 2
+#define PORTK2 2
+#define PK3 3
+#define PINK3 3
+#define DDK3 3
+#define PORTK3 3
+#define PK4 4
+#define PINK4 4
+#define DDK4 4
+#define PORTK4 4
+#define PK5 5
+#define PINK5 5
+#define DDK5 5
+#define PORTK5 5
+#define PK6 6
+#define PINK6 6
+#define DDK6 6
+#define PORTK6 6
+#define PK7 7
+#define PINK7 7
+#define DDK7 7
+#define PORTK7 7
+#define PL0 0
+#define PINL0 0
+#define DDL0 0
+#define PORTL0 0
+#define PL1 1
+#define PINL1 1
+#define DDL1 1
+#define PORTL1 1
+#define PL2 2
+#define PINL2 2
+#define DDL2 2
+#define PORTL2 2
+#define PL3 3
+#define PINL3 3
+#define DDL3 3
+#define PORTL3 3
+#define PL4 4
+#define PINL4 4
+#define DDL4 4
+#define PORTL4 4
+#define PL5 5
+#define PINL5 5
+#define DDL5 5
+#define PORTL5 5
+#define PL6 6
+#define PINL6 6
+#define DDL6 6
+#define PORTL6 6
+#define PL7 7
+#define PINL7 7
+#define DDL7 7
+#define PORTL7 7
+#define TOIE0 0
+#define OCIE0A 1
+#define OCIE0B 2
+#define TOV0 0
+#define OCF0A 1
+#define OCF0B 2
+#define WGM00 0
+#define WGM01 1
+#define COM0B0 4
+#define COM0B1 5
+#define COM0A0 6
+#define COM0A1 7
+#define CS00 0
+#define CS01 1
+#define CS02 2
+#define WGM02 3
+#define TOIE1 0
+#define OCIE1A 1
+#define OCIE1B 2
+#define OCIE1C 3
+#define ICIE1 5
+#define TOV1 0
+#define OCF1A 1
+#define OCF1B 2
+#define OCF1C 3
+#define ICF1 5
+#define WGM10 0
+#define WGM11 1
+#define COM1C0 2
+#define COM1C1 3
+#define COM1B0 4
+#define COM1B1 5
+#define COM1A0 6
+#define COM1A1 7
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define WGM12 3
+#define WGM13 4
+#define ICES1 6
+#define ICNC1 7
+#define TOIE2 0
+#define OCIE2A 1
+#define OCIE2B 2
+#define TOV2 0
+#define OCF2A 1
+#define OCF2B 2
+#define WGM20 0
+#define WGM21 1
+#define COM2B0 4
+#define COM2B1 5
+#define COM2A0 6
+#define COM2A1 7
+#define CS20 0
+#define CS21 1
+#define CS22 2
+#define WGM22 3
+#define TOIE3 0
+#define OCIE3A 1
+#define OCIE3B 2
+#define OCIE3C 3
+#define ICIE3 5
+#define TOV3 0
+#define OCF3A 1
+#define OCF3B 2
+#define OCF3C 3
+#define ICF3 5
+#define WGM30 0
+#define WGM31 1
+#define COM3C0 2
+#define COM3C1 3
+#define COM3B0 4
+#define COM3B1 5
+#define COM3A0 6
+#define COM3A1 7
+#define CS30 0
+#define CS31 1
+#define CS32 2
+#define WGM32 3
+#define WGM33 4
+#define ICES3 6
+#define ICNC3 7
+#define TOIE4 0
+#define OCIE4A 1
+#define OCIE4B 2
+#define OCIE4C 3
+#define ICIE4 5
+#define TOV4 0
+#define OCF4A 1
+#define OCF4B 2
+#define OCF4C 3
+#define ICF4 5
+#define WGM40 0
+#define WGM41 1
+#define COM4C0 2
+#define COM4C1 3
+#define COM4B0 4
+#define COM4B1 5
+#define COM4A0 6
+#define COM4A1 7
+#define CS40 0
+#define CS41 1
+#define CS42 2
+#define WGM42 3
+#define WGM43 4
+#define ICES4 6
+#define ICNC4 7
+#define TOIE5 0
+#define OCIE5A 1
+#define OCIE5B 2
+#define OCIE5C 3
+#define ICIE5 5
+#define TOV5 0
+#define OCF5A 1
+#define OCF5B 2
+#define OCF5C 3
+#define ICF5 5
+#define WGM50 0
+#define WGM51 1
+#define COM5C0 2
+#define COM5C1 3
+#define COM5B0 4
+#define COM5B1 5
+#define COM5A0 6
+#define COM5A1 7
+#define CS50 0
+#define CS51 1
+#define CS52 2
+#define WGM52 3
+#define WGM53 4
+#define ICES5 6
+#define ICNC5 7
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE 3
+#define ADIF 4
+#define ADATE 5
+#define ADSC 6
+#define ADEN 7
+#define MUX0 0
+#define MUX1 1
+#define MUX2 2
+#define MUX3 3
+#define MUX4 4
+#define ADLAR 5
+#define REFS0 6
+#define REFS1 7
+#define ADTS0 0
+#define ADTS1 1
+#define ADTS2 2
+#define MUX5 3
+#define ACME 6
+#define SPR0 0
+#define SPR1 1
+#define CPHA 2
+#define CPOL 3
+#define MSTR 4
+#define DORD 5
+#define SPE 6
+#define SPIE 7
+#define SPI2X 0
+#define WCOL 6
+#define SPIF 7
+#define INT0 0
+#define INT1 1
+#define INT2 2
+#define INT3 3
+#define INT4 4
+#define INT5 5
+#define INT6 6
+#define INT7 7
+#define INTF0 0
+#define INTF1 1
+#define INTF2 2
+#define INTF3 3
+#define INTF4 4
+#define INTF5 5
+#define INTF6 6
+#define INTF7 7
+#define ISC00 0
+#define ISC01 1
+#define ISC10 2
+#define ISC11 3
+#define ISC20 4
+#define ISC21 5
+#define ISC30 6
+#define ISC31 7
+#define ISC40 0
+#define ISC41 1
+#define ISC50 2
+#define ISC51 3
+#define ISC60 4
+#define ISC61 5
+#define ISC70 6
+#define ISC71 7
+#define PCIE0 0
+#define PCIE1 1
+#define PCIE2 2
+#define TCN2UB 0
+#define OCR2BUB 1
+#define OCR2AUB 2
+#define TCR2BUB 3
+#define TCR2AUB 4
+#define AS2 5
+#define EXCLK 6
+#define WDP0 0
+#define WDP1 1
+#define WDP2 2
+#define WDE 3
+#define WDCE 4
+#define WDP3 5
+#define WDIE 6
+#define WDIF 7
+#define PORF 0
+#define EXTRF 1
+#define BORF 2
+#define WDRF 3
+#define JTRF 4
+#define EERE 0
+#define EEPE 1
+#define EEMPE 2
+#define EERIE 3
+#define EEPM0 4
+#define EEPM1 5
+#define MPCM0 0
+#define U2X0 1
+#define UPE0 2
+#define DOR0 3
+#define FE0 4
+#define UDRE0 5
+#define TXC0 6
+#define RXC0 7
+#define TXB80 0
+#define RXB80 1
+#define UCSZ02 2
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define TXCIE0 6
+#define RXCIE0 7
+#define UCPOL0 0
+#define UCSZ00 1
+#define UCSZ01 2
+#define USBS0 3
+#define UPM00 4
+#define UPM01 5
+#define UMSEL00 6
+#define UMSEL01 7
+#define MPCM1 0
+#define U2X1 1
+#define UPE1 2
+#define DOR1 3
+#define FE1 4
+#define UDRE1 5
+#define TXC1 6
+#define RXC1 7
+#define TXB81 0
+#define RXB81 1
+#define UCSZ12 2
+#define TXEN1 3
+#define RXEN1 4
+#define UDRIE1 5
+#define TXCIE1 6
+#define RXCIE1 7
+#define UCPOL1 0
+#define UCSZ10 1
+#define UCSZ11 2
+#define USBS1 3
+#define UPM10 4
+#define UPM11 5
+#define UMSEL10 6
+#define UMSEL11 7
+#define MPCM2 0
+#define U2X2 1
+#define UPE2 2
+#define DOR2 3
+#define FE2 4
+#define UDRE2 5
+#define TXC2 6
+#define RXC2 7
+#define TXB82 0
+#define RXB82 1
+#define UCSZ22 2
+#define TXEN2 3
+#define RXEN2 4
+#define UDRIE2 5
+#define TXCIE2 6
+#define RXCIE2 7
+#define UCPOL2 0
+#define UCSZ20 1
+#define UCSZ21 2
+#define USBS2 3
+#define UPM20 4
+#define UPM21 5
+#define UMSEL20 6
+#define UMSEL21 7
+#define MPCM3 0
+#define U2X3 1
+#define UPE3 2
+#define DOR3 3
+#define FE3 4
+#define UDRE3 5
+#define TXC3 6
+#define RXC3 7
+#define TXB83 0
+#define RXB83 1
+#define UCSZ32 2
+#define TXEN3 3
+#define RXEN3 4
+#define UDRIE3 5
+#define TXCIE3 6
+#define RXCIE3 7
+#define UCPOL3 0
+#define UCSZ30 1
+#define UCSZ31 2
+#define USBS3 3
+#define UPM30 4
+#define UPM31 5
+#define UMSEL30 6
+#define UMSEL31 7
+#define TWIE 0
+#define TWEN 2
+#define TWWC 3
+#define TWSTO 4
+#define TWSTA 5
+#define TWEA 6
+#define TWINT 7
+#define TWPS0 0
+#define TWPS1 1
+#define TWS3 3
+#define TWS4 4
+#define TWS5 5
+#define TWS6 6
+#define TWS7 7
+#define ADC0D 0
+#define ADC8D 0
+#define ADC1D 1
+#define ADC9D 1
+#define ADC2D 2
+#define ADC10D 2
+#define ADC3D 3
+#define ADC11D 3
+#define ADC4D 4
+#define ADC12D 4
+#define ADC5D 5
+#define ADC13D 5
+#define ADC6D 6
+#define ADC14D 6
+#define ADC7D 7
+#define ADC15D 7
+#define SE 0
+#define SM0 1
+#define SM1 2
+#define SM2 3
+
+#endif /* TESTS_SIM_AVR_IO_H_ */
@@ -0,0 +1,17 @@
+/**
+ * @file
+ * @brief Host replacement of avr/sfr_defs.h for the simulation targets.
+ */
+
+#ifndef TESTS_SIM_AVR_SFR_DEFS_H_
+#define TESTS_SIM_AVR_SFR_DEFS_H_
+
+#define _BV(bit) (1 << (bit))
+#define _SFR_BYTE(sfr) (sfr)
+#define _SFR_WORD(sfr) (sfr)
+#define bit_is_set(sfr, bit) (_SFR_BYTE(sfr) & _BV(bit))
+#define bit_is_clear(sfr, bit) (!(_SFR_BYTE(sfr) & _BV(bit)))
+#define loop_until_bit_is_set(sfr, bit) do { } while (bit_is_clear(sfr, bit))
+#define loop_until_bit_is_clear(sfr, bit) do { } while (bit_is_set(sfr, bit))
+
+#endif /* TESTS_SIM_AVR_SFR_DEFS_H_ */
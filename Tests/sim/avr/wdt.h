@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief Host replacement of avr/wdt.h for the simulation targets.
+ */
+
+#ifndef TESTS_SIM_AVR_WDT_H_
+#define TESTS_SIM_AVR_WDT_H_
+
+#define WDTO_15MS 0
+#define WDTO_4S 8
+#define wdt_reset()
+#define wdt_enable(timeout)
+#define wdt_disable()
+
+#endif /* TESTS_SIM_AVR_WDT_H_ */
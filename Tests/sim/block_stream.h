@@ -0,0 +1,82 @@
+/**
+ * @file
+ * @brief Text serialization of the planned blocks for the host simulation targets.
+ *
+ * Only the block_t fields consumed by the stepper interrupt are stored,
+ * one block per line. Lines starting with '#' are comments.
+ * The stream is written by planner_sim --record at the moment the stepper picks
+ * a block up (its trapezoid is final then) and replayed by stepper_sim.
+ */
+
+#ifndef TESTS_SIM_BLOCK_STREAM_H_
+#define TESTS_SIM_BLOCK_STREAM_H_
+
+#include <stdio.h>
+#include <string.h>
+
+#include "planner.h"
+
+inline void block_stream_write_header(FILE *f)
+{
+    fputs("# steps_x steps_y steps_z steps_e step_event_count acceleration_rate direction_bits"
+          " accelerate_until decelerate_after nominal_rate initial_rate final_rate acceleration_st flag"
+          " use_advance_lead abs_adv_steps_multiplier8\n", f);
+}
+
+inline void block_stream_write(FILE *f, const block_t *block)
+{
+#ifdef LIN_ADVANCE
+    const int use_advance_lead = block->use_advance_lead;
+    const unsigned long abs_adv_steps_multiplier8 = block->abs_adv_steps_multiplier8;
+#else
+    const int use_advance_lead = 0;
+    const unsigned long abs_adv_steps_multiplier8 = 0;
+#endif
+    fprintf(f, "%ld %ld %ld %ld %lu %ld %u %ld %ld %lu %lu %lu %lu %u %d %lu\n",
+        (long)block->steps_x.wide, (long)block->steps_y.wide, (long)block->steps_z.wide, (long)block->steps_e.wide,
+        (unsigned long)block->step_event_count.wide, block->acceleration_rate, block->direction_bits,
+        block->accelerate_until, block->decelerate_after,
+        (unsigned long)block->nominal_rate, (unsigned long)block->initial_rate, (unsigned long)block->final_rate,
+        block->acceleration_st, block->flag,
+        use_advance_lead, abs_adv_steps_multiplier8);
+}
+
+//! @return false at the end of the stream.
+inline bool block_stream_read(FILE *f, block_t *block)
+{
+    char line[256];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+        long sx, sy, sz, se;
+        unsigned long n, nominal_rate, initial_rate, final_rate;
+        unsigned int dir, flag;
+        int use_advance_lead;
+        unsigned long abs_adv_steps_multiplier8;
+        memset(block, 0, sizeof(block_t));
+        if (sscanf(line, "%ld %ld %ld %ld %lu %ld %u %ld %ld %lu %lu %lu %lu %u %d %lu",
+                &sx, &sy, &sz, &se, &n, &block->acceleration_rate, &dir,
+                &block->accelerate_until, &block->decelerate_after,
+                &nominal_rate, &initial_rate, &final_rate, &block->acceleration_st, &flag,
+                &use_advance_lead, &abs_adv_steps_multiplier8) != 16)
+            return false;
+        block->steps_x.wide = sx;
+        block->steps_y.wide = sy;
+        block->steps_z.wide = sz;
+        block->steps_e.wide = se;
+        block->step_event_count.wide = n;
+        block->nominal_rate = nominal_rate;
+        block->initial_rate = initial_rate;
+        block->final_rate = final_rate;
+        block->direction_bits = (unsigned char)dir;
+        block->flag = (uint8_t)flag;
+#ifdef LIN_ADVANCE
+        block->use_advance_lead = use_advance_lead != 0;
+        block->abs_adv_steps_multiplier8 = abs_adv_steps_multiplier8;
+#endif
+        return true;
+    }
+    return false;
+}
+
+#endif /* TESTS_SIM_BLOCK_STREAM_H_ */
@@ -0,0 +1,475 @@
+/**
+ * @file
+ * @brief Host planner simulator and throughput benchmark.
+ *
+ * Replays a G-code file through the unmodified Firmware/planner.cpp
+ * (plan_buffer_line(), planner_recalculate(), calculate_trapezoid_for_block())
+ * and reports the planning cost per block together with the planner queue
+ * starvation as seen by a simulated stepper.
+ *
+ * The stepper routine is replaced by a model, which consumes the planned blocks
+ * in simulated time by integrating their trapezoids. The main loop is assumed
+ * to spend a fixed amount of simulated time per G-code line (reading, parsing,
+ * planning), see --segment-us, or the measured host planning time multiplied
+ * by --cpu-scale.
+ *
+ * The print is preceded by two jogs of the idle printer several seconds apart, the firmware
+ * telemetry (M721) shall not count the idle time as an underrun.
+ *
+ * The running extrusion rate of the queue kept by the planner for the hotend feed-forward
+ * is checked against the sum over the queued blocks after each G-code line.
+ *
+ * With --record, the blocks are written in the order they are picked up by the
+ * simulated stepper to a block stream, which may be replayed by stepper_sim.
+ *
+ * Usage: planner_sim [--segment-us N] [--cpu-scale K] [--record blocks.txt] file.gcode
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Marlin.h"
+#include "planner.h"
+#include "stepper.h"
+#include "temperature.h"
+#include "motion_control.h"
+#include "block_stream.h"
+#include "cardreader.h"
+#include "sim_avr.h"
+#include "sim_marlin.h"
+
+typedef std::chrono::steady_clock host_clock;
+
+//===========================================================================
+//=============================temperature.cpp replacement==================
+//===========================================================================
+
+float current_temperature[EXTRUDERS] = { 215.f };
+unsigned char fanSpeedSoftPwm = 0;
+uint8_t fanSpeedBckp = 255;
+bool fan_measuring = false;
+
+//===========================================================================
+//=============================cardreader.cpp replacement===================
+//===========================================================================
+
+bool SdBaseFile::close() { return true; }
+CardReader::CardReader() {}
+CardReader card;
+
+//===========================================================================
+//=============================stepper model ================================
+//===========================================================================
+
+block_t *current_block;
+volatile long count_position[NUM_AXIS] = { 0, 0, 0, 0 };
+
+//! Simulated time remaining to finish the current block [us].
+static double s_block_remaining_us;
+//! Simulated time of the end of the last stepper model update [us].
+static uint64_t s_stepper_time_us;
+
+static struct
+{
+    //! Number of blocks retired by the stepper model.
+    uint32_t blocks_executed;
+    //! Number of transitions of the planner queue to empty while the print was running.
+    uint32_t starvations;
+    //! Simulated time spent with the planner queue empty while the print was running [us].
+    uint64_t starved_us;
+    //! Minimum planner queue occupancy observed when a G-code line was read.
+    uint8_t queue_min;
+    //! Host time spent inside plan_buffer_line() waiting for a free planner slot.
+    host_clock::duration wait;
+    //! Number of the lines, after which planner_extrusion_rate() differed from extrusion_rate_reference().
+    uint32_t extrusion_rate_errors;
+} s_stats;
+
+//! Block stream written by --record, or NULL.
+static FILE *s_record;
+
+//! The print is running, an empty planner queue means starvation.
+static bool s_printing;
+static bool s_starving;
+#ifdef PLANNER_DIAGNOSTICS
+//! Idle time of the stepper model not yet converted to the 1kHz idle ticks [us].
+static uint64_t s_idle_us;
+#endif /* PLANNER_DIAGNOSTICS */
+
+//! Duration of a block in microseconds, integrated from its trapezoid.
+static double block_duration_us(const block_t *block)
+{
+    const double a  = block->acceleration_st ? double(block->acceleration_st) : 1.;
+    const double v0 = block->initial_rate;
+    const double vn = block->nominal_rate;
+    const double vf = block->final_rate;
+    const double n  = block->step_event_count.wide;
+    const double n_acc   = block->accelerate_until;
+    const double n_plato = double(block->decelerate_after - block->accelerate_until);
+    const double n_dec   = n - double(block->decelerate_after);
+    double t = 0.;
+    // Acceleration phase.
+    double v1 = sqrt(v0 * v0 + 2. * a * n_acc);
+    if (v1 > vn)
+        v1 = vn;
+    if (v1 > v0)
+        t += (v1 - v0) / a;
+    else
+        v1 = v0;
+    // Cruising phase.
+    if (n_plato > 0.)
+        t += n_plato / v1;
+    // Deceleration phase.
+    if (n_dec > 0.) {
+        double v2sqr = v1 * v1 - 2. * a * n_dec;
+        double v2 = (v2sqr > vf * vf) ? sqrt(v2sqr) : vf;
+        t += (v1 > v2) ? (v1 - v2) / a : n_dec / v1;
+    }
+    return t * 1000000.;
+}
+
+//! Pick the next block up for execution.
+static block_t* stepper_model_next_block()
+{
+    block_t *block = plan_get_current_block();
+    if (block != NULL) {
+        s_block_remaining_us = block_duration_us(block);
+        if (s_record != NULL)
+            block_stream_write(s_record, block);
+    }
+    return block;
+}
+
+static void block_retire(const block_t *block)
+{
+    const long steps[NUM_AXIS] = { block->steps_x.wide, block->steps_y.wide, block->steps_z.wide, block->steps_e.wide };
+    for (uint8_t axis = 0; axis < NUM_AXIS; ++ axis)
+        count_position[axis] += (block->direction_bits & (1 << axis)) ? - steps[axis] : steps[axis];
+    ++ s_stats.blocks_executed;
+}
+
+//! Run the stepper model until the simulated clock.
+//! If stop_at_block_end is set, stop after the first retired block.
+static void stepper_model_run(bool stop_at_block_end)
+{
+    const uint64_t now = sim_clock_us();
+    while (s_stepper_time_us < now) {
+        if (current_block == NULL) {
+            current_block = stepper_model_next_block();
+            if (current_block == NULL) {
+                // Nothing to do.
+                if (s_printing) {
+                    if (! s_starving)
+                        ++ s_stats.starvations;
+                    s_starving = true;
+                    s_stats.starved_us += now - s_stepper_time_us;
+                }
+#ifdef PLANNER_DIAGNOSTICS
+                // The idle tick of the stepper interrupt, feeds the firmware telemetry.
+                s_idle_us += now - s_stepper_time_us;
+                for (; s_idle_us >= 1000; s_idle_us -= 1000)
+                    if (planner_queue_empty_ms != 0xffff)
+                        ++ planner_queue_empty_ms;
+#endif /* PLANNER_DIAGNOSTICS */
+                s_stepper_time_us = now;
+                break;
+            }
+            s_starving = false;
+        }
+        const double dt = double(now - s_stepper_time_us);
+        if (s_block_remaining_us > dt) {
+            s_block_remaining_us -= dt;
+            s_stepper_time_us = now;
+        } else {
+            s_stepper_time_us += uint64_t(s_block_remaining_us + 0.5);
+            block_retire(current_block);
+            current_block = NULL;
+            plan_discard_current_block();
+            if (stop_at_block_end)
+                break;
+        }
+    }
+}
+
+//! Called while plan_buffer_line() waits for a free slot: the simulated time
+//! jumps to the end of the block being executed.
+static void sim_idle()
+{
+    host_clock::time_point t0 = host_clock::now();
+    if (current_block == NULL)
+        current_block = stepper_model_next_block();
+    if (current_block != NULL)
+        sim_clock_advance(uint64_t(s_block_remaining_us) + 1);
+    stepper_model_run(true);
+    s_stats.wait += host_clock::now() - t0;
+}
+
+//! Filament volume per second of the queued blocks, summed over the queue.
+static float extrusion_rate_reference()
+{
+    double e_steps = 0., duration = 0.;
+    for (uint8_t i = block_buffer_tail; i != block_buffer_head; i = (i + 1) & (BLOCK_BUFFER_SIZE - 1)) {
+        const block_t *block = &block_buffer[i];
+        duration += block->millimeters / block->nominal_speed;
+        if ((block->direction_bits & (1 << E_AXIS)) == 0)
+            e_steps += block->steps_e.wide;
+    }
+    if (duration <= 0.)
+        return 0.f;
+    return e_steps / cs.axis_steps_per_unit[E_AXIS] / duration * (M_PI / 4 * DEFAULT_NOMINAL_FILAMENT_DIA * DEFAULT_NOMINAL_FILAMENT_DIA);
+}
+
+void manage_heater()
+{
+    sim_idle();
+}
+
+void st_set_position(const long &x, const long &y, const long &z, const long &e)
+{
+    count_position[X_AXIS] = x;
+    count_position[Y_AXIS] = y;
+    count_position[Z_AXIS] = z;
+    count_position[E_AXIS] = e;
+}
+
+void st_set_e_position(const long &e)
+{
+    count_position[E_AXIS] = e;
+}
+
+long st_get_position(uint8_t axis)
+{
+    return count_position[axis];
+}
+
+float st_get_position_mm(uint8_t axis)
+{
+    return st_get_position(axis) / cs.axis_steps_per_unit[axis];
+}
+
+void quickStop()
+{
+    while (blocks_queued())
+        plan_discard_current_block();
+    current_block = NULL;
+}
+
+//===========================================================================
+//=============================G-code replay ===============================
+//===========================================================================
+
+//! Minimal G-code front-end, mirrors get_coordinates() / prepare_move() of Marlin_main.cpp
+//! for G0, G1, G2, G3 (I J center format), G28, G90, G91, G92, M82 and M83.
+class GcodeReplay
+{
+public:
+    GcodeReplay() : m_feedrate(1500.f), m_relative(false), m_relative_e(false) {}
+
+    //! @return true if the line was a move, which was passed to the planner.
+    bool line(const std::string &raw)
+    {
+        std::string s = raw.substr(0, raw.find(';'));
+        if (s.empty())
+            return false;
+        char letter = toupper(s[0]);
+        int code = atoi(s.c_str() + 1);
+        if (letter == 'G' && (code == 0 || code == 1)) {
+            for (uint8_t i = 0; i < NUM_AXIS; ++ i) {
+                float v;
+                if (value(s, axis_codes(i), v))
+                    destination[i] = (relative(i) ? current_position[i] : 0.f) + v;
+                else
+                    destination[i] = current_position[i];
+            }
+            float f;
+            if (value(s, 'F', f) && f > 0.f)
+                m_feedrate = f;
+            plan_buffer_line(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], destination[E_AXIS],
+                m_feedrate * feedmultiply * (1.f / (60.f * 100.f)), active_extruder);
+            memcpy(current_position, destination, sizeof(current_position));
+            return true;
+        }
+        if (letter == 'G' && (code == 2 || code == 3)) {
+            float offset[NUM_AXIS] = { 0.f, 0.f, 0.f, 0.f };
+            for (uint8_t i = 0; i < NUM_AXIS; ++ i) {
+                float v;
+                if (value(s, axis_codes(i), v))
+                    destination[i] = (relative(i) ? current_position[i] : 0.f) + v;
+                else
+                    destination[i] = current_position[i];
+            }
+            value(s, 'I', offset[X_AXIS]);
+            value(s, 'J', offset[Y_AXIS]);
+            float f;
+            if (value(s, 'F', f) && f > 0.f)
+                m_feedrate = f;
+            mc_arc(current_position, destination, offset, X_AXIS, Y_AXIS, Z_AXIS, m_feedrate * feedmultiply / 60 / 100.0,
+                hypot(offset[X_AXIS], offset[Y_AXIS]), code == 2, active_extruder);
+            memcpy(current_position, destination, sizeof(current_position));
+            return true;
+        }
+        if (letter == 'G' && (code == 28 || code == 92)) {
+            bool any = false;
+            for (uint8_t i = 0; i < NUM_AXIS; ++ i) {
+                float v;
+                if (value(s, axis_codes(i), v)) {
+                    current_position[i] = (code == 28) ? 0.f : v;
+                    any = true;
+                }
+            }
+            if (code == 28 && ! any)
+                memset(current_position, 0, sizeof(float) * 3);
+            plan_set_position(current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS]);
+        } else if (letter == 'G' && code == 90) {
+            m_relative = false;
+            m_relative_e = false;
+        } else if (letter == 'G' && code == 91) {
+            m_relative = true;
+            m_relative_e = true;
+        } else if (letter == 'M' && code == 82) {
+            m_relative_e = false;
+        } else if (letter == 'M' && code == 83) {
+            m_relative_e = true;
+        }
+        return false;
+    }
+
+private:
+    static char axis_codes(uint8_t i) { return "XYZE"[i]; }
+    bool relative(uint8_t axis) const { return (axis == E_AXIS) ? m_relative_e : m_relative; }
+    static bool value(const std::string &s, char c, float &out)
+    {
+        for (size_t i = 1; i < s.size(); ++ i)
+            if (toupper(s[i]) == c && (s[i - 1] == ' ' || s[i - 1] == '\t')) {
+                out = strtod(s.c_str() + i + 1, NULL);
+                return true;
+            }
+        return false;
+    }
+
+    float m_feedrate;
+    bool  m_relative;
+    bool  m_relative_e;
+};
+
+int main(int argc, char *argv[])
+{
+    unsigned long segment_us = 1000;
+    double cpu_scale = 0.;
+    const char *path = NULL;
+    const char *record = NULL;
+    for (int i = 1; i < argc; ++ i) {
+        std::string arg = argv[i];
+        if (arg == "--segment-us" && i + 1 < argc)
+            segment_us = strtoul(argv[++ i], NULL, 10);
+        else if (arg == "--cpu-scale" && i + 1 < argc)
+            cpu_scale = strtod(argv[++ i], NULL);
+        else if (arg == "--record" && i + 1 < argc)
+            record = argv[++ i];
+        else
+            path = argv[i];
+    }
+    if (path == NULL) {
+        std::cerr << "Usage: planner_sim [--segment-us N] [--cpu-scale K] [--record blocks.txt] file.gcode" << std::endl;
+        return 1;
+    }
+    std::ifstream in(path);
+    if (! in) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+    }
+    if (record != NULL) {
+        if ((s_record = fopen(record, "w")) == NULL) {
+            std::cerr << "Cannot create " << record << std::endl;
+            return 1;
+        }
+        block_stream_write_header(s_record);
+    }
+
+    sim_avr_reset();
+    sim_marlin_reset();
+    reset_acceleration_rates();
+    plan_init();
+    sim_idle_hook = sim_idle;
+    s_stats.queue_min = BLOCK_BUFFER_SIZE;
+
+    GcodeReplay gcode;
+    // Jogs of the idle printer, e.g. from the LCD, with an idle gap in between.
+    gcode.line("G1 X1 F3000");
+    sim_clock_advance(5000000);
+    stepper_model_run(false);
+    gcode.line("G1 X0 F3000");
+    while (blocks_queued() || current_block != NULL)
+        sim_idle();
+    // The host print starts, synchronized by its G28 in the firmware.
+    is_usb_printing = true;
+    planner_stats_expect_drain();
+
+    uint32_t lines = 0;
+    uint32_t moves = 0;
+    uint32_t worst_line = 0;
+    host_clock::duration plan_total(0);
+    host_clock::duration plan_worst(0);
+    std::string line;
+    while (std::getline(in, line)) {
+        ++ lines;
+        uint8_t queued = moves_planned();
+        if (s_printing && queued < s_stats.queue_min)
+            s_stats.queue_min = queued;
+        host_clock::duration wait_before = s_stats.wait;
+        host_clock::time_point t0 = host_clock::now();
+        bool move = gcode.line(line);
+        host_clock::duration dt = host_clock::now() - t0 - (s_stats.wait - wait_before);
+        if (move) {
+            ++ moves;
+            s_printing = true;
+            plan_total += dt;
+            if (dt > plan_worst) {
+                plan_worst = dt;
+                worst_line = lines;
+            }
+        }
+        sim_clock_advance((cpu_scale > 0.) ?
+            uint64_t(cpu_scale * std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count() / 1000.) :
+            segment_us);
+        stepper_model_run(false);
+        const float rate = planner_extrusion_rate();
+        const float reference = extrusion_rate_reference();
+        if (fabs(rate - reference) > 1e-3f * reference + 1e-4f)
+            ++ s_stats.extrusion_rate_errors;
+    }
+    // Drain the queue, the print has ended.
+    s_printing = false;
+    while (blocks_queued() || current_block != NULL)
+        sim_idle();
+    is_usb_printing = false;
+    if (s_record != NULL)
+        fclose(s_record);
+
+    const double plan_total_us = std::chrono::duration_cast<std::chrono::nanoseconds>(plan_total).count() / 1000.;
+    const double plan_worst_us = std::chrono::duration_cast<std::chrono::nanoseconds>(plan_worst).count() / 1000.;
+    printf("lines:                %u\n", lines);
+    printf("moves planned:        %u\n", moves);
+    printf("blocks executed:      %u\n", s_stats.blocks_executed);
+    printf("planning time:        %.3f ms\n", plan_total_us / 1000.);
+    printf("planning throughput:  %.0f blocks/s\n", (plan_total_us > 0.) ? moves * 1000000. / plan_total_us : 0.);
+    printf("mean per block:       %.3f us\n", moves ? plan_total_us / moves : 0.);
+    printf("worst per block:      %.3f us (line %u)\n", plan_worst_us, worst_line);
+    printf("queue min occupancy:  %u\n", s_stats.queue_min);
+    printf("queue starvations:    %u\n", s_stats.starvations);
+    printf("starved time:         %.3f s\n", s_stats.starved_us / 1000000.);
+    printf("simulated print time: %.3f s\n", sim_clock_us() / 1000000.);
+    printf("extrusion rate errors: %u\n", s_stats.extrusion_rate_errors);
+#ifdef PLANNER_DIAGNOSTICS
+    // The firmware telemetry as reported by M721, shall agree with the model above.
+    printf("M721 min occupancy:   %u\n", planner_stats.queue_min);
+    printf("M721 avg occupancy:   %.1f\n", planner_stats.samples ? double(planner_stats.queue_sum) / planner_stats.samples : 0.);
+    printf("M721 underruns:       %u\n", planner_stats.underruns);
+    printf("M721 starved time:    %.3f s\n", planner_stats.starved_ms / 1000.);
+    if (planner_stats.underruns != s_stats.starvations)
+        return 1;
+#endif /* PLANNER_DIAGNOSTICS */
+    return (s_stats.extrusion_rate_errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @brief Storage of the simulated ATmega2560 registers and EEPROM, simulated time base.
+ */
+
+#include <string.h>
+#include "Arduino.h"
+#include <avr/eeprom.h>
+#include "timer02.h"
+#include "sim_avr.h"
+
+#define SIM_SFR8_DEFINE(reg) volatile uint8_t sim_##reg;
+#define SIM_SFR16_DEFINE(reg) volatile uint16_t sim_##reg;
+SIM_SFR8_LIST(SIM_SFR8_DEFINE)
+SIM_SFR16_LIST(SIM_SFR16_DEFINE)
+
+uint8_t sim_eeprom[4096];
+
+static uint64_t s_clock_us = 0;
+
+void sim_avr_reset()
+{
+#define SIM_SFR_CLEAR(reg) sim_##reg = 0;
+    SIM_SFR8_LIST(SIM_SFR_CLEAR)
+    SIM_SFR16_LIST(SIM_SFR_CLEAR)
+    // The UART transmitters are always ready, the transmitted characters are dropped.
+    UCSR0A = _BV(UDRE0);
+    UCSR1A = _BV(UDRE1);
+    // Erased EEPROM.
+    memset(sim_eeprom, 0xFF, sizeof(sim_eeprom));
+    s_clock_us = 0;
+}
+
+uint64_t sim_clock_us()
+{
+    return s_clock_us;
+}
+
+void sim_clock_advance(uint64_t us)
+{
+    s_clock_us += us;
+}
+
+unsigned long millis(void)  { return (unsigned long)(s_clock_us / 1000); }
+unsigned long micros(void)  { return (unsigned long)s_clock_us; }
+unsigned long millis2(void) { return (unsigned long)(s_clock_us / 1000); }
+unsigned long micros2(void) { return (unsigned long)s_clock_us; }
+void delay(unsigned long ms) { s_clock_us += ms * 1000; }
+void delay2(unsigned long ms) { s_clock_us += ms * 1000; }
+void delayMicroseconds(unsigned int us) { s_clock_us += us; }
+void tone2(uint8_t, unsigned int) {}
+void noTone2(uint8_t) {}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return LOW; }
+int analogRead(uint8_t) { return 0; }
+void analogWrite(uint8_t, int) {}
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @brief Simulated MCU state shared by the host simulation targets.
+ *
+ * The simulated clock is independent from the wall clock of the host.
+ * It is advanced explicitly by the simulator and it drives millis(), micros()
+ * and their timer2 based counterparts used by the firmware.
+ */
+
+#ifndef TESTS_SIM_SIM_AVR_H_
+#define TESTS_SIM_SIM_AVR_H_
+
+#include <stdint.h>
+
+//! Reset the special function registers, EEPROM contents and the simulated clock.
+void sim_avr_reset();
+
+//! Current simulated time in microseconds.
+uint64_t sim_clock_us();
+
+//! Advance the simulated time.
+void sim_clock_advance(uint64_t us);
+
+#endif /* TESTS_SIM_SIM_AVR_H_ */
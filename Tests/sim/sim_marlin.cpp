@@ -0,0 +1,110 @@
+/**
+ * @file
+ * @brief Replacement of the Marlin_main.cpp global state for the host simulation targets.
+ *
+ * Only the globals and functions referenced by the firmware modules compiled
+ * into the simulators are defined here, with their firmware types.
+ */
+
+#include <stdio.h>
+#include "Marlin.h"
+#include "ConfigurationStore.h"
+#include "mesh_bed_calibration.h"
+#include "tmc2130.h"
+#include "sim_marlin.h"
+
+void (*sim_idle_hook)() = 0;
+
+float current_position[NUM_AXIS] = { 0.0, 0.0, 0.0, 0.0 };
+float destination[NUM_AXIS] = { 0.0, 0.0, 0.0, 0.0 };
+uint8_t active_extruder = 0;
+int fanSpeed = 0;
+bool is_usb_printing = false;
+int feedmultiply = 100;
+int extrudemultiply = 100;
+int extruder_multiply[EXTRUDERS] = {100};
+float volumetric_multiplier[EXTRUDERS] = {1.0};
+
+const char errormagic[] PROGMEM = "Error:";
+const char echomagic[] PROGMEM = "echo:";
+
+// mesh_bed_calibration.cpp
+uint8_t world2machine_correction_mode = WORLD2MACHINE_CORRECTION_NONE;
+float world2machine_rotation_and_skew[2][2] = { { 1.f, 0.f }, { 0.f, 1.f } };
+float world2machine_rotation_and_skew_inv[2][2] = { { 1.f, 0.f }, { 0.f, 1.f } };
+float world2machine_shift[2] = { 0.f, 0.f };
+
+// tmc2130.cpp
+uint8_t tmc2130_mode = TMC2130_MODE_NORMAL;
+
+M500_conf cs;
+
+void sim_marlin_reset()
+{
+    static const M500_conf default_conf =
+    {
+        "V2",
+        DEFAULT_AXIS_STEPS_PER_UNIT,
+        DEFAULT_MAX_FEEDRATE,
+        DEFAULT_MAX_ACCELERATION,
+        DEFAULT_ACCELERATION,
+        DEFAULT_RETRACT_ACCELERATION,
+        DEFAULT_MINIMUMFEEDRATE,
+        DEFAULT_MINTRAVELFEEDRATE,
+        DEFAULT_MINSEGMENTTIME,
+        {DEFAULT_XJERK, DEFAULT_YJERK, DEFAULT_ZJERK, DEFAULT_EJERK},
+        {0,0,0},
+        -(Z_PROBE_OFFSET_FROM_EXTRUDER),
+        DEFAULT_Kp,
+        DEFAULT_Ki*PID_dT,
+        DEFAULT_Kd/PID_dT,
+        DEFAULT_bedKp,
+        DEFAULT_bedKi*PID_dT,
+        DEFAULT_bedKd/PID_dT,
+        0,
+        false,
+        RETRACT_LENGTH,
+        RETRACT_FEEDRATE,
+        RETRACT_ZLIFT,
+        RETRACT_RECOVER_LENGTH,
+        RETRACT_RECOVER_FEEDRATE,
+        false,
+        {DEFAULT_NOMINAL_FILAMENT_DIA},
+        DEFAULT_MAX_FEEDRATE_SILENT,
+        DEFAULT_MAX_ACCELERATION_SILENT,
+        { TMC2130_USTEPS_XY, TMC2130_USTEPS_XY, TMC2130_USTEPS_Z, TMC2130_USTEPS_E },
+    };
+    cs = default_conf;
+    tmc2130_mode = TMC2130_MODE_NORMAL;
+    world2machine_correction_mode = WORLD2MACHINE_CORRECTION_NONE;
+    memset(current_position, 0, sizeof(current_position));
+    memset(destination, 0, sizeof(destination));
+    active_extruder = 0;
+    fanSpeed = 0;
+}
+
+void serialprintPGM(const char *str)
+{
+    fputs(str, stderr);
+}
+
+void manage_inactivity(bool /*ignore_stepper_queue*/)
+{
+    if (sim_idle_hook)
+        sim_idle_hook();
+}
+
+void lcd_update(uint8_t /*lcdDrawUpdateOverride*/)
+{
+    if (sim_idle_hook)
+        sim_idle_hook();
+}
+
+void enable_force_z()
+{
+}
+
+//! Software endstops are not simulated.
+void clamp_to_software_endstops(float * /*target*/)
+{
+}
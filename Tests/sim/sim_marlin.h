@@ -0,0 +1,17 @@
+/**
+ * @file
+ * @brief Replacement of the Marlin_main.cpp global state for the host simulation targets.
+ */
+
+#ifndef TESTS_SIM_SIM_MARLIN_H_
+#define TESTS_SIM_SIM_MARLIN_H_
+
+//! Load the compiled-in default settings into cs, the same way as Config_ResetDefault() does,
+//! and reset the front-end position.
+void sim_marlin_reset();
+
+//! Hook called by the simulated manage_inactivity() and lcd_update(),
+//! e.g. while plan_buffer_line() waits for a free slot in the planner queue.
+extern void (*sim_idle_hook)();
+
+#endif /* TESTS_SIM_SIM_MARLIN_H_ */
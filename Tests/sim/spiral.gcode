@@ -0,0 +1,905 @@
+; Spiral vase of short segments for the planner simulator
+G28
+G90
+M83
+G1 Z0.2 F1200
+G1 X125.000 Y105.000 Z0.203 E0.05760 F6000
+G1 X124.924 Y106.743 Z0.206 E0.05760 F6000
+G1 X124.696 Y108.473 Z0.208 E0.05760 F6000
+G1 X124.319 Y110.176 Z0.211 E0.05760 F6000
+G1 X123.794 Y111.840 Z0.214 E0.05760 F6000
+G1 X123.126 Y113.452 Z0.217 E0.05760 F6000
+G1 X122.321 Y115.000 Z0.219 E0.05760 F6000
+G1 X121.383 Y116.472 Z0.222 E0.05760 F6000
+G1 X120.321 Y117.856 Z0.225 E0.05760 F6000
+G1 X119.142 Y119.142 Z0.228 E0.05760 F6000
+G1 X117.856 Y120.321 Z0.231 E0.05760 F6000
+G1 X116.472 Y121.383 Z0.233 E0.05760 F6000
+G1 X115.000 Y122.321 Z0.236 E0.05760 F6000
+G1 X113.452 Y123.126 Z0.239 E0.05760 F6000
+G1 X111.840 Y123.794 Z0.242 E0.05760 F6000
+G1 X110.176 Y124.319 Z0.244 E0.05760 F6000
+G1 X108.473 Y124.696 Z0.247 E0.05760 F6000
+G1 X106.743 Y124.924 Z0.250 E0.05760 F6000
+G1 X105.000 Y125.000 Z0.253 E0.05760 F6000
+G1 X103.257 Y124.924 Z0.256 E0.05760 F6000
+G1 X101.527 Y124.696 Z0.258 E0.05760 F6000
+G1 X99.824 Y124.319 Z0.261 E0.05760 F6000
+G1 X98.160 Y123.794 Z0.264 E0.05760 F6000
+G1 X96.548 Y123.126 Z0.267 E0.05760 F6000
+G1 X95.000 Y122.321 Z0.269 E0.05760 F6000
+G1 X93.528 Y121.383 Z0.272 E0.05760 F6000
+G1 X92.144 Y120.321 Z0.275 E0.05760 F6000
+G1 X90.858 Y119.142 Z0.278 E0.05760 F6000
+G1 X89.679 Y117.856 Z0.281 E0.05760 F6000
+G1 X88.617 Y116.472 Z0.283 E0.05760 F6000
+G1 X87.679 Y115.000 Z0.286 E0.05760 F6000
+G1 X86.874 Y113.452 Z0.289 E0.05760 F6000
+G1 X86.206 Y111.840 Z0.292 E0.05760 F6000
+G1 X85.681 Y110.176 Z0.294 E0.05760 F6000
+G1 X85.304 Y108.473 Z0.297 E0.05760 F6000
+G1 X85.076 Y106.743 Z0.300 E0.05760 F6000
+G1 X85.000 Y105.000 Z0.303 E0.05760 F6000
+G1 X85.076 Y103.257 Z0.306 E0.05760 F6000
+G1 X85.304 Y101.527 Z0.308 E0.05760 F6000
+G1 X85.681 Y99.824 Z0.311 E0.05760 F6000
+G1 X86.206 Y98.160 Z0.314 E0.05760 F6000
+G1 X86.874 Y96.548 Z0.317 E0.05760 F6000
+G1 X87.679 Y95.000 Z0.319 E0.05760 F6000
+G1 X88.617 Y93.528 Z0.322 E0.05760 F6000
+G1 X89.679 Y92.144 Z0.325 E0.05760 F6000
+G1 X90.858 Y90.858 Z0.328 E0.05760 F6000
+G1 X92.144 Y89.679 Z0.331 E0.05760 F6000
+G1 X93.528 Y88.617 Z0.333 E0.05760 F6000
+G1 X95.000 Y87.679 Z0.336 E0.05760 F6000
+G1 X96.548 Y86.874 Z0.339 E0.05760 F6000
+G1 X98.160 Y86.206 Z0.342 E0.05760 F6000
+G1 X99.824 Y85.681 Z0.344 E0.05760 F6000
+G1 X101.527 Y85.304 Z0.347 E0.05760 F6000
+G1 X103.257 Y85.076 Z0.350 E0.05760 F6000
+G1 X105.000 Y85.000 Z0.353 E0.05760 F6000
+G1 X106.743 Y85.076 Z0.356 E0.05760 F6000
+G1 X108.473 Y85.304 Z0.358 E0.05760 F6000
+G1 X110.176 Y85.681 Z0.361 E0.05760 F6000
+G1 X111.840 Y86.206 Z0.364 E0.05760 F6000
+G1 X113.452 Y86.874 Z0.367 E0.05760 F6000
+G1 X115.000 Y87.679 Z0.369 E0.05760 F6000
+G1 X116.472 Y88.617 Z0.372 E0.05760 F6000
+G1 X117.856 Y89.679 Z0.375 E0.05760 F6000
+G1 X119.142 Y90.858 Z0.378 E0.05760 F6000
+G1 X120.321 Y92.144 Z0.381 E0.05760 F6000
+G1 X121.383 Y93.528 Z0.383 E0.05760 F6000
+G1 X122.321 Y95.000 Z0.386 E0.05760 F6000
+G1 X123.126 Y96.548 Z0.389 E0.05760 F6000
+G1 X123.794 Y98.160 Z0.392 E0.05760 F6000
+G1 X124.319 Y99.824 Z0.394 E0.05760 F6000
+G1 X124.696 Y101.527 Z0.397 E0.05760 F6000
+G1 X124.924 Y103.257 Z0.400 E0.05760 F6000
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z0.403 E0.05760 F2400
+G1 X124.924 Y106.743 Z0.406 E0.05760 F2400
+G1 X124.696 Y108.473 Z0.408 E0.05760 F2400
+G1 X124.319 Y110.176 Z0.411 E0.05760 F2400
+G1 X123.794 Y111.840 Z0.414 E0.05760 F2400
+G1 X123.126 Y113.452 Z0.417 E0.05760 F2400
+G1 X122.321 Y115.000 Z0.419 E0.05760 F2400
+G1 X121.383 Y116.472 Z0.422 E0.05760 F2400
+G1 X120.321 Y117.856 Z0.425 E0.05760 F2400
+G1 X119.142 Y119.142 Z0.428 E0.05760 F2400
+G1 X117.856 Y120.321 Z0.431 E0.05760 F2400
+G1 X116.472 Y121.383 Z0.433 E0.05760 F2400
+G1 X115.000 Y122.321 Z0.436 E0.05760 F2400
+G1 X113.452 Y123.126 Z0.439 E0.05760 F2400
+G1 X111.840 Y123.794 Z0.442 E0.05760 F2400
+G1 X110.176 Y124.319 Z0.444 E0.05760 F2400
+G1 X108.473 Y124.696 Z0.447 E0.05760 F2400
+G1 X106.743 Y124.924 Z0.450 E0.05760 F2400
+G1 X105.000 Y125.000 Z0.453 E0.05760 F2400
+G1 X103.257 Y124.924 Z0.456 E0.05760 F2400
+G1 X101.527 Y124.696 Z0.458 E0.05760 F2400
+G1 X99.824 Y124.319 Z0.461 E0.05760 F2400
+G1 X98.160 Y123.794 Z0.464 E0.05760 F2400
+G1 X96.548 Y123.126 Z0.467 E0.05760 F2400
+G1 X95.000 Y122.321 Z0.469 E0.05760 F2400
+G1 X93.528 Y121.383 Z0.472 E0.05760 F2400
+G1 X92.144 Y120.321 Z0.475 E0.05760 F2400
+G1 X90.858 Y119.142 Z0.478 E0.05760 F2400
+G1 X89.679 Y117.856 Z0.481 E0.05760 F2400
+G1 X88.617 Y116.472 Z0.483 E0.05760 F2400
+G1 X87.679 Y115.000 Z0.486 E0.05760 F2400
+G1 X86.874 Y113.452 Z0.489 E0.05760 F2400
+G1 X86.206 Y111.840 Z0.492 E0.05760 F2400
+G1 X85.681 Y110.176 Z0.494 E0.05760 F2400
+G1 X85.304 Y108.473 Z0.497 E0.05760 F2400
+G1 X85.076 Y106.743 Z0.500 E0.05760 F2400
+G1 X85.000 Y105.000 Z0.503 E0.05760 F2400
+G1 X85.076 Y103.257 Z0.506 E0.05760 F2400
+G1 X85.304 Y101.527 Z0.508 E0.05760 F2400
+G1 X85.681 Y99.824 Z0.511 E0.05760 F2400
+G1 X86.206 Y98.160 Z0.514 E0.05760 F2400
+G1 X86.874 Y96.548 Z0.517 E0.05760 F2400
+G1 X87.679 Y95.000 Z0.519 E0.05760 F2400
+G1 X88.617 Y93.528 Z0.522 E0.05760 F2400
+G1 X89.679 Y92.144 Z0.525 E0.05760 F2400
+G1 X90.858 Y90.858 Z0.528 E0.05760 F2400
+G1 X92.144 Y89.679 Z0.531 E0.05760 F2400
+G1 X93.528 Y88.617 Z0.533 E0.05760 F2400
+G1 X95.000 Y87.679 Z0.536 E0.05760 F2400
+G1 X96.548 Y86.874 Z0.539 E0.05760 F2400
+G1 X98.160 Y86.206 Z0.542 E0.05760 F2400
+G1 X99.824 Y85.681 Z0.544 E0.05760 F2400
+G1 X101.527 Y85.304 Z0.547 E0.05760 F2400
+G1 X103.257 Y85.076 Z0.550 E0.05760 F2400
+G1 X105.000 Y85.000 Z0.553 E0.05760 F2400
+G1 X106.743 Y85.076 Z0.556 E0.05760 F2400
+G1 X108.473 Y85.304 Z0.558 E0.05760 F2400
+G1 X110.176 Y85.681 Z0.561 E0.05760 F2400
+G1 X111.840 Y86.206 Z0.564 E0.05760 F2400
+G1 X113.452 Y86.874 Z0.567 E0.05760 F2400
+G1 X115.000 Y87.679 Z0.569 E0.05760 F2400
+G1 X116.472 Y88.617 Z0.572 E0.05760 F2400
+G1 X117.856 Y89.679 Z0.575 E0.05760 F2400
+G1 X119.142 Y90.858 Z0.578 E0.05760 F2400
+G1 X120.321 Y92.144 Z0.581 E0.05760 F2400
+G1 X121.383 Y93.528 Z0.583 E0.05760 F2400
+G1 X122.321 Y95.000 Z0.586 E0.05760 F2400
+G1 X123.126 Y96.548 Z0.589 E0.05760 F2400
+G1 X123.794 Y98.160 Z0.592 E0.05760 F2400
+G1 X124.319 Y99.824 Z0.594 E0.05760 F2400
+G1 X124.696 Y101.527 Z0.597 E0.05760 F2400
+G1 X124.924 Y103.257 Z0.600 E0.05760 F2400
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z0.603 E0.05760 F6000
+G1 X124.924 Y106.743 Z0.606 E0.05760 F6000
+G1 X124.696 Y108.473 Z0.608 E0.05760 F6000
+G1 X124.319 Y110.176 Z0.611 E0.05760 F6000
+G1 X123.794 Y111.840 Z0.614 E0.05760 F6000
+G1 X123.126 Y113.452 Z0.617 E0.05760 F6000
+G1 X122.321 Y115.000 Z0.619 E0.05760 F6000
+G1 X121.383 Y116.472 Z0.622 E0.05760 F6000
+G1 X120.321 Y117.856 Z0.625 E0.05760 F6000
+G1 X119.142 Y119.142 Z0.628 E0.05760 F6000
+G1 X117.856 Y120.321 Z0.631 E0.05760 F6000
+G1 X116.472 Y121.383 Z0.633 E0.05760 F6000
+G1 X115.000 Y122.321 Z0.636 E0.05760 F6000
+G1 X113.452 Y123.126 Z0.639 E0.05760 F6000
+G1 X111.840 Y123.794 Z0.642 E0.05760 F6000
+G1 X110.176 Y124.319 Z0.644 E0.05760 F6000
+G1 X108.473 Y124.696 Z0.647 E0.05760 F6000
+G1 X106.743 Y124.924 Z0.650 E0.05760 F6000
+G1 X105.000 Y125.000 Z0.653 E0.05760 F6000
+G1 X103.257 Y124.924 Z0.656 E0.05760 F6000
+G1 X101.527 Y124.696 Z0.658 E0.05760 F6000
+G1 X99.824 Y124.319 Z0.661 E0.05760 F6000
+G1 X98.160 Y123.794 Z0.664 E0.05760 F6000
+G1 X96.548 Y123.126 Z0.667 E0.05760 F6000
+G1 X95.000 Y122.321 Z0.669 E0.05760 F6000
+G1 X93.528 Y121.383 Z0.672 E0.05760 F6000
+G1 X92.144 Y120.321 Z0.675 E0.05760 F6000
+G1 X90.858 Y119.142 Z0.678 E0.05760 F6000
+G1 X89.679 Y117.856 Z0.681 E0.05760 F6000
+G1 X88.617 Y116.472 Z0.683 E0.05760 F6000
+G1 X87.679 Y115.000 Z0.686 E0.05760 F6000
+G1 X86.874 Y113.452 Z0.689 E0.05760 F6000
+G1 X86.206 Y111.840 Z0.692 E0.05760 F6000
+G1 X85.681 Y110.176 Z0.694 E0.05760 F6000
+G1 X85.304 Y108.473 Z0.697 E0.05760 F6000
+G1 X85.076 Y106.743 Z0.700 E0.05760 F6000
+G1 X85.000 Y105.000 Z0.703 E0.05760 F6000
+G1 X85.076 Y103.257 Z0.706 E0.05760 F6000
+G1 X85.304 Y101.527 Z0.708 E0.05760 F6000
+G1 X85.681 Y99.824 Z0.711 E0.05760 F6000
+G1 X86.206 Y98.160 Z0.714 E0.05760 F6000
+G1 X86.874 Y96.548 Z0.717 E0.05760 F6000
+G1 X87.679 Y95.000 Z0.719 E0.05760 F6000
+G1 X88.617 Y93.528 Z0.722 E0.05760 F6000
+G1 X89.679 Y92.144 Z0.725 E0.05760 F6000
+G1 X90.858 Y90.858 Z0.728 E0.05760 F6000
+G1 X92.144 Y89.679 Z0.731 E0.05760 F6000
+G1 X93.528 Y88.617 Z0.733 E0.05760 F6000
+G1 X95.000 Y87.679 Z0.736 E0.05760 F6000
+G1 X96.548 Y86.874 Z0.739 E0.05760 F6000
+G1 X98.160 Y86.206 Z0.742 E0.05760 F6000
+G1 X99.824 Y85.681 Z0.744 E0.05760 F6000
+G1 X101.527 Y85.304 Z0.747 E0.05760 F6000
+G1 X103.257 Y85.076 Z0.750 E0.05760 F6000
+G1 X105.000 Y85.000 Z0.753 E0.05760 F6000
+G1 X106.743 Y85.076 Z0.756 E0.05760 F6000
+G1 X108.473 Y85.304 Z0.758 E0.05760 F6000
+G1 X110.176 Y85.681 Z0.761 E0.05760 F6000
+G1 X111.840 Y86.206 Z0.764 E0.05760 F6000
+G1 X113.452 Y86.874 Z0.767 E0.05760 F6000
+G1 X115.000 Y87.679 Z0.769 E0.05760 F6000
+G1 X116.472 Y88.617 Z0.772 E0.05760 F6000
+G1 X117.856 Y89.679 Z0.775 E0.05760 F6000
+G1 X119.142 Y90.858 Z0.778 E0.05760 F6000
+G1 X120.321 Y92.144 Z0.781 E0.05760 F6000
+G1 X121.383 Y93.528 Z0.783 E0.05760 F6000
+G1 X122.321 Y95.000 Z0.786 E0.05760 F6000
+G1 X123.126 Y96.548 Z0.789 E0.05760 F6000
+G1 X123.794 Y98.160 Z0.792 E0.05760 F6000
+G1 X124.319 Y99.824 Z0.794 E0.05760 F6000
+G1 X124.696 Y101.527 Z0.797 E0.05760 F6000
+G1 X124.924 Y103.257 Z0.800 E0.05760 F6000
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z0.803 E0.05760 F2400
+G1 X124.924 Y106.743 Z0.806 E0.05760 F2400
+G1 X124.696 Y108.473 Z0.808 E0.05760 F2400
+G1 X124.319 Y110.176 Z0.811 E0.05760 F2400
+G1 X123.794 Y111.840 Z0.814 E0.05760 F2400
+G1 X123.126 Y113.452 Z0.817 E0.05760 F2400
+G1 X122.321 Y115.000 Z0.819 E0.05760 F2400
+G1 X121.383 Y116.472 Z0.822 E0.05760 F2400
+G1 X120.321 Y117.856 Z0.825 E0.05760 F2400
+G1 X119.142 Y119.142 Z0.828 E0.05760 F2400
+G1 X117.856 Y120.321 Z0.831 E0.05760 F2400
+G1 X116.472 Y121.383 Z0.833 E0.05760 F2400
+G1 X115.000 Y122.321 Z0.836 E0.05760 F2400
+G1 X113.452 Y123.126 Z0.839 E0.05760 F2400
+G1 X111.840 Y123.794 Z0.842 E0.05760 F2400
+G1 X110.176 Y124.319 Z0.844 E0.05760 F2400
+G1 X108.473 Y124.696 Z0.847 E0.05760 F2400
+G1 X106.743 Y124.924 Z0.850 E0.05760 F2400
+G1 X105.000 Y125.000 Z0.853 E0.05760 F2400
+G1 X103.257 Y124.924 Z0.856 E0.05760 F2400
+G1 X101.527 Y124.696 Z0.858 E0.05760 F2400
+G1 X99.824 Y124.319 Z0.861 E0.05760 F2400
+G1 X98.160 Y123.794 Z0.864 E0.05760 F2400
+G1 X96.548 Y123.126 Z0.867 E0.05760 F2400
+G1 X95.000 Y122.321 Z0.869 E0.05760 F2400
+G1 X93.528 Y121.383 Z0.872 E0.05760 F2400
+G1 X92.144 Y120.321 Z0.875 E0.05760 F2400
+G1 X90.858 Y119.142 Z0.878 E0.05760 F2400
+G1 X89.679 Y117.856 Z0.881 E0.05760 F2400
+G1 X88.617 Y116.472 Z0.883 E0.05760 F2400
+G1 X87.679 Y115.000 Z0.886 E0.05760 F2400
+G1 X86.874 Y113.452 Z0.889 E0.05760 F2400
+G1 X86.206 Y111.840 Z0.892 E0.05760 F2400
+G1 X85.681 Y110.176 Z0.894 E0.05760 F2400
+G1 X85.304 Y108.473 Z0.897 E0.05760 F2400
+G1 X85.076 Y106.743 Z0.900 E0.05760 F2400
+G1 X85.000 Y105.000 Z0.903 E0.05760 F2400
+G1 X85.076 Y103.257 Z0.906 E0.05760 F2400
+G1 X85.304 Y101.527 Z0.908 E0.05760 F2400
+G1 X85.681 Y99.824 Z0.911 E0.05760 F2400
+G1 X86.206 Y98.160 Z0.914 E0.05760 F2400
+G1 X86.874 Y96.548 Z0.917 E0.05760 F2400
+G1 X87.679 Y95.000 Z0.919 E0.05760 F2400
+G1 X88.617 Y93.528 Z0.922 E0.05760 F2400
+G1 X89.679 Y92.144 Z0.925 E0.05760 F2400
+G1 X90.858 Y90.858 Z0.928 E0.05760 F2400
+G1 X92.144 Y89.679 Z0.931 E0.05760 F2400
+G1 X93.528 Y88.617 Z0.933 E0.05760 F2400
+G1 X95.000 Y87.679 Z0.936 E0.05760 F2400
+G1 X96.548 Y86.874 Z0.939 E0.05760 F2400
+G1 X98.160 Y86.206 Z0.942 E0.05760 F2400
+G1 X99.824 Y85.681 Z0.944 E0.05760 F2400
+G1 X101.527 Y85.304 Z0.947 E0.05760 F2400
+G1 X103.257 Y85.076 Z0.950 E0.05760 F2400
+G1 X105.000 Y85.000 Z0.953 E0.05760 F2400
+G1 X106.743 Y85.076 Z0.956 E0.05760 F2400
+G1 X108.473 Y85.304 Z0.958 E0.05760 F2400
+G1 X110.176 Y85.681 Z0.961 E0.05760 F2400
+G1 X111.840 Y86.206 Z0.964 E0.05760 F2400
+G1 X113.452 Y86.874 Z0.967 E0.05760 F2400
+G1 X115.000 Y87.679 Z0.969 E0.05760 F2400
+G1 X116.472 Y88.617 Z0.972 E0.05760 F2400
+G1 X117.856 Y89.679 Z0.975 E0.05760 F2400
+G1 X119.142 Y90.858 Z0.978 E0.05760 F2400
+G1 X120.321 Y92.144 Z0.981 E0.05760 F2400
+G1 X121.383 Y93.528 Z0.983 E0.05760 F2400
+G1 X122.321 Y95.000 Z0.986 E0.05760 F2400
+G1 X123.126 Y96.548 Z0.989 E0.05760 F2400
+G1 X123.794 Y98.160 Z0.992 E0.05760 F2400
+G1 X124.319 Y99.824 Z0.994 E0.05760 F2400
+G1 X124.696 Y101.527 Z0.997 E0.05760 F2400
+G1 X124.924 Y103.257 Z1.000 E0.05760 F2400
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z1.003 E0.05760 F6000
+G1 X124.924 Y106.743 Z1.006 E0.05760 F6000
+G1 X124.696 Y108.473 Z1.008 E0.05760 F6000
+G1 X124.319 Y110.176 Z1.011 E0.05760 F6000
+G1 X123.794 Y111.840 Z1.014 E0.05760 F6000
+G1 X123.126 Y113.452 Z1.017 E0.05760 F6000
+G1 X122.321 Y115.000 Z1.019 E0.05760 F6000
+G1 X121.383 Y116.472 Z1.022 E0.05760 F6000
+G1 X120.321 Y117.856 Z1.025 E0.05760 F6000
+G1 X119.142 Y119.142 Z1.028 E0.05760 F6000
+G1 X117.856 Y120.321 Z1.031 E0.05760 F6000
+G1 X116.472 Y121.383 Z1.033 E0.05760 F6000
+G1 X115.000 Y122.321 Z1.036 E0.05760 F6000
+G1 X113.452 Y123.126 Z1.039 E0.05760 F6000
+G1 X111.840 Y123.794 Z1.042 E0.05760 F6000
+G1 X110.176 Y124.319 Z1.044 E0.05760 F6000
+G1 X108.473 Y124.696 Z1.047 E0.05760 F6000
+G1 X106.743 Y124.924 Z1.050 E0.05760 F6000
+G1 X105.000 Y125.000 Z1.053 E0.05760 F6000
+G1 X103.257 Y124.924 Z1.056 E0.05760 F6000
+G1 X101.527 Y124.696 Z1.058 E0.05760 F6000
+G1 X99.824 Y124.319 Z1.061 E0.05760 F6000
+G1 X98.160 Y123.794 Z1.064 E0.05760 F6000
+G1 X96.548 Y123.126 Z1.067 E0.05760 F6000
+G1 X95.000 Y122.321 Z1.069 E0.05760 F6000
+G1 X93.528 Y121.383 Z1.072 E0.05760 F6000
+G1 X92.144 Y120.321 Z1.075 E0.05760 F6000
+G1 X90.858 Y119.142 Z1.078 E0.05760 F6000
+G1 X89.679 Y117.856 Z1.081 E0.05760 F6000
+G1 X88.617 Y116.472 Z1.083 E0.05760 F6000
+G1 X87.679 Y115.000 Z1.086 E0.05760 F6000
+G1 X86.874 Y113.452 Z1.089 E0.05760 F6000
+G1 X86.206 Y111.840 Z1.092 E0.05760 F6000
+G1 X85.681 Y110.176 Z1.094 E0.05760 F6000
+G1 X85.304 Y108.473 Z1.097 E0.05760 F6000
+G1 X85.076 Y106.743 Z1.100 E0.05760 F6000
+G1 X85.000 Y105.000 Z1.103 E0.05760 F6000
+G1 X85.076 Y103.257 Z1.106 E0.05760 F6000
+G1 X85.304 Y101.527 Z1.108 E0.05760 F6000
+G1 X85.681 Y99.824 Z1.111 E0.05760 F6000
+G1 X86.206 Y98.160 Z1.114 E0.05760 F6000
+G1 X86.874 Y96.548 Z1.117 E0.05760 F6000
+G1 X87.679 Y95.000 Z1.119 E0.05760 F6000
+G1 X88.617 Y93.528 Z1.122 E0.05760 F6000
+G1 X89.679 Y92.144 Z1.125 E0.05760 F6000
+G1 X90.858 Y90.858 Z1.128 E0.05760 F6000
+G1 X92.144 Y89.679 Z1.131 E0.05760 F6000
+G1 X93.528 Y88.617 Z1.133 E0.05760 F6000
+G1 X95.000 Y87.679 Z1.136 E0.05760 F6000
+G1 X96.548 Y86.874 Z1.139 E0.05760 F6000
+G1 X98.160 Y86.206 Z1.142 E0.05760 F6000
+G1 X99.824 Y85.681 Z1.144 E0.05760 F6000
+G1 X101.527 Y85.304 Z1.147 E0.05760 F6000
+G1 X103.257 Y85.076 Z1.150 E0.05760 F6000
+G1 X105.000 Y85.000 Z1.153 E0.05760 F6000
+G1 X106.743 Y85.076 Z1.156 E0.05760 F6000
+G1 X108.473 Y85.304 Z1.158 E0.05760 F6000
+G1 X110.176 Y85.681 Z1.161 E0.05760 F6000
+G1 X111.840 Y86.206 Z1.164 E0.05760 F6000
+G1 X113.452 Y86.874 Z1.167 E0.05760 F6000
+G1 X115.000 Y87.679 Z1.169 E0.05760 F6000
+G1 X116.472 Y88.617 Z1.172 E0.05760 F6000
+G1 X117.856 Y89.679 Z1.175 E0.05760 F6000
+G1 X119.142 Y90.858 Z1.178 E0.05760 F6000
+G1 X120.321 Y92.144 Z1.181 E0.05760 F6000
+G1 X121.383 Y93.528 Z1.183 E0.05760 F6000
+G1 X122.321 Y95.000 Z1.186 E0.05760 F6000
+G1 X123.126 Y96.548 Z1.189 E0.05760 F6000
+G1 X123.794 Y98.160 Z1.192 E0.05760 F6000
+G1 X124.319 Y99.824 Z1.194 E0.05760 F6000
+G1 X124.696 Y101.527 Z1.197 E0.05760 F6000
+G1 X124.924 Y103.257 Z1.200 E0.05760 F6000
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z1.203 E0.05760 F2400
+G1 X124.924 Y106.743 Z1.206 E0.05760 F2400
+G1 X124.696 Y108.473 Z1.208 E0.05760 F2400
+G1 X124.319 Y110.176 Z1.211 E0.05760 F2400
+G1 X123.794 Y111.840 Z1.214 E0.05760 F2400
+G1 X123.126 Y113.452 Z1.217 E0.05760 F2400
+G1 X122.321 Y115.000 Z1.219 E0.05760 F2400
+G1 X121.383 Y116.472 Z1.222 E0.05760 F2400
+G1 X120.321 Y117.856 Z1.225 E0.05760 F2400
+G1 X119.142 Y119.142 Z1.228 E0.05760 F2400
+G1 X117.856 Y120.321 Z1.231 E0.05760 F2400
+G1 X116.472 Y121.383 Z1.233 E0.05760 F2400
+G1 X115.000 Y122.321 Z1.236 E0.05760 F2400
+G1 X113.452 Y123.126 Z1.239 E0.05760 F2400
+G1 X111.840 Y123.794 Z1.242 E0.05760 F2400
+G1 X110.176 Y124.319 Z1.244 E0.05760 F2400
+G1 X108.473 Y124.696 Z1.247 E0.05760 F2400
+G1 X106.743 Y124.924 Z1.250 E0.05760 F2400
+G1 X105.000 Y125.000 Z1.253 E0.05760 F2400
+G1 X103.257 Y124.924 Z1.256 E0.05760 F2400
+G1 X101.527 Y124.696 Z1.258 E0.05760 F2400
+G1 X99.824 Y124.319 Z1.261 E0.05760 F2400
+G1 X98.160 Y123.794 Z1.264 E0.05760 F2400
+G1 X96.548 Y123.126 Z1.267 E0.05760 F2400
+G1 X95.000 Y122.321 Z1.269 E0.05760 F2400
+G1 X93.528 Y121.383 Z1.272 E0.05760 F2400
+G1 X92.144 Y120.321 Z1.275 E0.05760 F2400
+G1 X90.858 Y119.142 Z1.278 E0.05760 F2400
+G1 X89.679 Y117.856 Z1.281 E0.05760 F2400
+G1 X88.617 Y116.472 Z1.283 E0.05760 F2400
+G1 X87.679 Y115.000 Z1.286 E0.05760 F2400
+G1 X86.874 Y113.452 Z1.289 E0.05760 F2400
+G1 X86.206 Y111.840 Z1.292 E0.05760 F2400
+G1 X85.681 Y110.176 Z1.294 E0.05760 F2400
+G1 X85.304 Y108.473 Z1.297 E0.05760 F2400
+G1 X85.076 Y106.743 Z1.300 E0.05760 F2400
+G1 X85.000 Y105.000 Z1.303 E0.05760 F2400
+G1 X85.076 Y103.257 Z1.306 E0.05760 F2400
+G1 X85.304 Y101.527 Z1.308 E0.05760 F2400
+G1 X85.681 Y99.824 Z1.311 E0.05760 F2400
+G1 X86.206 Y98.160 Z1.314 E0.05760 F2400
+G1 X86.874 Y96.548 Z1.317 E0.05760 F2400
+G1 X87.679 Y95.000 Z1.319 E0.05760 F2400
+G1 X88.617 Y93.528 Z1.322 E0.05760 F2400
+G1 X89.679 Y92.144 Z1.325 E0.05760 F2400
+G1 X90.858 Y90.858 Z1.328 E0.05760 F2400
+G1 X92.144 Y89.679 Z1.331 E0.05760 F2400
+G1 X93.528 Y88.617 Z1.333 E0.05760 F2400
+G1 X95.000 Y87.679 Z1.336 E0.05760 F2400
+G1 X96.548 Y86.874 Z1.339 E0.05760 F2400
+G1 X98.160 Y86.206 Z1.342 E0.05760 F2400
+G1 X99.824 Y85.681 Z1.344 E0.05760 F2400
+G1 X101.527 Y85.304 Z1.347 E0.05760 F2400
+G1 X103.257 Y85.076 Z1.350 E0.05760 F2400
+G1 X105.000 Y85.000 Z1.353 E0.05760 F2400
+G1 X106.743 Y85.076 Z1.356 E0.05760 F2400
+G1 X108.473 Y85.304 Z1.358 E0.05760 F2400
+G1 X110.176 Y85.681 Z1.361 E0.05760 F2400
+G1 X111.840 Y86.206 Z1.364 E0.05760 F2400
+G1 X113.452 Y86.874 Z1.367 E0.05760 F2400
+G1 X115.000 Y87.679 Z1.369 E0.05760 F2400
+G1 X116.472 Y88.617 Z1.372 E0.05760 F2400
+G1 X117.856 Y89.679 Z1.375 E0.05760 F2400
+G1 X119.142 Y90.858 Z1.378 E0.05760 F2400
+G1 X120.321 Y92.144 Z1.381 E0.05760 F2400
+G1 X121.383 Y93.528 Z1.383 E0.05760 F2400
+G1 X122.321 Y95.000 Z1.386 E0.05760 F2400
+G1 X123.126 Y96.548 Z1.389 E0.05760 F2400
+G1 X123.794 Y98.160 Z1.392 E0.05760 F2400
+G1 X124.319 Y99.824 Z1.394 E0.05760 F2400
+G1 X124.696 Y101.527 Z1.397 E0.05760 F2400
+G1 X124.924 Y103.257 Z1.400 E0.05760 F2400
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z1.403 E0.05760 F6000
+G1 X124.924 Y106.743 Z1.406 E0.05760 F6000
+G1 X124.696 Y108.473 Z1.408 E0.05760 F6000
+G1 X124.319 Y110.176 Z1.411 E0.05760 F6000
+G1 X123.794 Y111.840 Z1.414 E0.05760 F6000
+G1 X123.126 Y113.452 Z1.417 E0.05760 F6000
+G1 X122.321 Y115.000 Z1.419 E0.05760 F6000
+G1 X121.383 Y116.472 Z1.422 E0.05760 F6000
+G1 X120.321 Y117.856 Z1.425 E0.05760 F6000
+G1 X119.142 Y119.142 Z1.428 E0.05760 F6000
+G1 X117.856 Y120.321 Z1.431 E0.05760 F6000
+G1 X116.472 Y121.383 Z1.433 E0.05760 F6000
+G1 X115.000 Y122.321 Z1.436 E0.05760 F6000
+G1 X113.452 Y123.126 Z1.439 E0.05760 F6000
+G1 X111.840 Y123.794 Z1.442 E0.05760 F6000
+G1 X110.176 Y124.319 Z1.444 E0.05760 F6000
+G1 X108.473 Y124.696 Z1.447 E0.05760 F6000
+G1 X106.743 Y124.924 Z1.450 E0.05760 F6000
+G1 X105.000 Y125.000 Z1.453 E0.05760 F6000
+G1 X103.257 Y124.924 Z1.456 E0.05760 F6000
+G1 X101.527 Y124.696 Z1.458 E0.05760 F6000
+G1 X99.824 Y124.319 Z1.461 E0.05760 F6000
+G1 X98.160 Y123.794 Z1.464 E0.05760 F6000
+G1 X96.548 Y123.126 Z1.467 E0.05760 F6000
+G1 X95.000 Y122.321 Z1.469 E0.05760 F6000
+G1 X93.528 Y121.383 Z1.472 E0.05760 F6000
+G1 X92.144 Y120.321 Z1.475 E0.05760 F6000
+G1 X90.858 Y119.142 Z1.478 E0.05760 F6000
+G1 X89.679 Y117.856 Z1.481 E0.05760 F6000
+G1 X88.617 Y116.472 Z1.483 E0.05760 F6000
+G1 X87.679 Y115.000 Z1.486 E0.05760 F6000
+G1 X86.874 Y113.452 Z1.489 E0.05760 F6000
+G1 X86.206 Y111.840 Z1.492 E0.05760 F6000
+G1 X85.681 Y110.176 Z1.494 E0.05760 F6000
+G1 X85.304 Y108.473 Z1.497 E0.05760 F6000
+G1 X85.076 Y106.743 Z1.500 E0.05760 F6000
+G1 X85.000 Y105.000 Z1.503 E0.05760 F6000
+G1 X85.076 Y103.257 Z1.506 E0.05760 F6000
+G1 X85.304 Y101.527 Z1.508 E0.05760 F6000
+G1 X85.681 Y99.824 Z1.511 E0.05760 F6000
+G1 X86.206 Y98.160 Z1.514 E0.05760 F6000
+G1 X86.874 Y96.548 Z1.517 E0.05760 F6000
+G1 X87.679 Y95.000 Z1.519 E0.05760 F6000
+G1 X88.617 Y93.528 Z1.522 E0.05760 F6000
+G1 X89.679 Y92.144 Z1.525 E0.05760 F6000
+G1 X90.858 Y90.858 Z1.528 E0.05760 F6000
+G1 X92.144 Y89.679 Z1.531 E0.05760 F6000
+G1 X93.528 Y88.617 Z1.533 E0.05760 F6000
+G1 X95.000 Y87.679 Z1.536 E0.05760 F6000
+G1 X96.548 Y86.874 Z1.539 E0.05760 F6000
+G1 X98.160 Y86.206 Z1.542 E0.05760 F6000
+G1 X99.824 Y85.681 Z1.544 E0.05760 F6000
+G1 X101.527 Y85.304 Z1.547 E0.05760 F6000
+G1 X103.257 Y85.076 Z1.550 E0.05760 F6000
+G1 X105.000 Y85.000 Z1.553 E0.05760 F6000
+G1 X106.743 Y85.076 Z1.556 E0.05760 F6000
+G1 X108.473 Y85.304 Z1.558 E0.05760 F6000
+G1 X110.176 Y85.681 Z1.561 E0.05760 F6000
+G1 X111.840 Y86.206 Z1.564 E0.05760 F6000
+G1 X113.452 Y86.874 Z1.567 E0.05760 F6000
+G1 X115.000 Y87.679 Z1.569 E0.05760 F6000
+G1 X116.472 Y88.617 Z1.572 E0.05760 F6000
+G1 X117.856 Y89.679 Z1.575 E0.05760 F6000
+G1 X119.142 Y90.858 Z1.578 E0.05760 F6000
+G1 X120.321 Y92.144 Z1.581 E0.05760 F6000
+G1 X121.383 Y93.528 Z1.583 E0.05760 F6000
+G1 X122.321 Y95.000 Z1.586 E0.05760 F6000
+G1 X123.126 Y96.548 Z1.589 E0.05760 F6000
+G1 X123.794 Y98.160 Z1.592 E0.05760 F6000
+G1 X124.319 Y99.824 Z1.594 E0.05760 F6000
+G1 X124.696 Y101.527 Z1.597 E0.05760 F6000
+G1 X124.924 Y103.257 Z1.600 E0.05760 F6000
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z1.603 E0.05760 F2400
+G1 X124.924 Y106.743 Z1.606 E0.05760 F2400
+G1 X124.696 Y108.473 Z1.608 E0.05760 F2400
+G1 X124.319 Y110.176 Z1.611 E0.05760 F2400
+G1 X123.794 Y111.840 Z1.614 E0.05760 F2400
+G1 X123.126 Y113.452 Z1.617 E0.05760 F2400
+G1 X122.321 Y115.000 Z1.619 E0.05760 F2400
+G1 X121.383 Y116.472 Z1.622 E0.05760 F2400
+G1 X120.321 Y117.856 Z1.625 E0.05760 F2400
+G1 X119.142 Y119.142 Z1.628 E0.05760 F2400
+G1 X117.856 Y120.321 Z1.631 E0.05760 F2400
+G1 X116.472 Y121.383 Z1.633 E0.05760 F2400
+G1 X115.000 Y122.321 Z1.636 E0.05760 F2400
+G1 X113.452 Y123.126 Z1.639 E0.05760 F2400
+G1 X111.840 Y123.794 Z1.642 E0.05760 F2400
+G1 X110.176 Y124.319 Z1.644 E0.05760 F2400
+G1 X108.473 Y124.696 Z1.647 E0.05760 F2400
+G1 X106.743 Y124.924 Z1.650 E0.05760 F2400
+G1 X105.000 Y125.000 Z1.653 E0.05760 F2400
+G1 X103.257 Y124.924 Z1.656 E0.05760 F2400
+G1 X101.527 Y124.696 Z1.658 E0.05760 F2400
+G1 X99.824 Y124.319 Z1.661 E0.05760 F2400
+G1 X98.160 Y123.794 Z1.664 E0.05760 F2400
+G1 X96.548 Y123.126 Z1.667 E0.05760 F2400
+G1 X95.000 Y122.321 Z1.669 E0.05760 F2400
+G1 X93.528 Y121.383 Z1.672 E0.05760 F2400
+G1 X92.144 Y120.321 Z1.675 E0.05760 F2400
+G1 X90.858 Y119.142 Z1.678 E0.05760 F2400
+G1 X89.679 Y117.856 Z1.681 E0.05760 F2400
+G1 X88.617 Y116.472 Z1.683 E0.05760 F2400
+G1 X87.679 Y115.000 Z1.686 E0.05760 F2400
+G1 X86.874 Y113.452 Z1.689 E0.05760 F2400
+G1 X86.206 Y111.840 Z1.692 E0.05760 F2400
+G1 X85.681 Y110.176 Z1.694 E0.05760 F2400
+G1 X85.304 Y108.473 Z1.697 E0.05760 F2400
+G1 X85.076 Y106.743 Z1.700 E0.05760 F2400
+G1 X85.000 Y105.000 Z1.703 E0.05760 F2400
+G1 X85.076 Y103.257 Z1.706 E0.05760 F2400
+G1 X85.304 Y101.527 Z1.708 E0.05760 F2400
+G1 X85.681 Y99.824 Z1.711 E0.05760 F2400
+G1 X86.206 Y98.160 Z1.714 E0.05760 F2400
+G1 X86.874 Y96.548 Z1.717 E0.05760 F2400
+G1 X87.679 Y95.000 Z1.719 E0.05760 F2400
+G1 X88.617 Y93.528 Z1.722 E0.05760 F2400
+G1 X89.679 Y92.144 Z1.725 E0.05760 F2400
+G1 X90.858 Y90.858 Z1.728 E0.05760 F2400
+G1 X92.144 Y89.679 Z1.731 E0.05760 F2400
+G1 X93.528 Y88.617 Z1.733 E0.05760 F2400
+G1 X95.000 Y87.679 Z1.736 E0.05760 F2400
+G1 X96.548 Y86.874 Z1.739 E0.05760 F2400
+G1 X98.160 Y86.206 Z1.742 E0.05760 F2400
+G1 X99.824 Y85.681 Z1.744 E0.05760 F2400
+G1 X101.527 Y85.304 Z1.747 E0.05760 F2400
+G1 X103.257 Y85.076 Z1.750 E0.05760 F2400
+G1 X105.000 Y85.000 Z1.753 E0.05760 F2400
+G1 X106.743 Y85.076 Z1.756 E0.05760 F2400
+G1 X108.473 Y85.304 Z1.758 E0.05760 F2400
+G1 X110.176 Y85.681 Z1.761 E0.05760 F2400
+G1 X111.840 Y86.206 Z1.764 E0.05760 F2400
+G1 X113.452 Y86.874 Z1.767 E0.05760 F2400
+G1 X115.000 Y87.679 Z1.769 E0.05760 F2400
+G1 X116.472 Y88.617 Z1.772 E0.05760 F2400
+G1 X117.856 Y89.679 Z1.775 E0.05760 F2400
+G1 X119.142 Y90.858 Z1.778 E0.05760 F2400
+G1 X120.321 Y92.144 Z1.781 E0.05760 F2400
+G1 X121.383 Y93.528 Z1.783 E0.05760 F2400
+G1 X122.321 Y95.000 Z1.786 E0.05760 F2400
+G1 X123.126 Y96.548 Z1.789 E0.05760 F2400
+G1 X123.794 Y98.160 Z1.792 E0.05760 F2400
+G1 X124.319 Y99.824 Z1.794 E0.05760 F2400
+G1 X124.696 Y101.527 Z1.797 E0.05760 F2400
+G1 X124.924 Y103.257 Z1.800 E0.05760 F2400
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z1.803 E0.05760 F6000
+G1 X124.924 Y106.743 Z1.806 E0.05760 F6000
+G1 X124.696 Y108.473 Z1.808 E0.05760 F6000
+G1 X124.319 Y110.176 Z1.811 E0.05760 F6000
+G1 X123.794 Y111.840 Z1.814 E0.05760 F6000
+G1 X123.126 Y113.452 Z1.817 E0.05760 F6000
+G1 X122.321 Y115.000 Z1.819 E0.05760 F6000
+G1 X121.383 Y116.472 Z1.822 E0.05760 F6000
+G1 X120.321 Y117.856 Z1.825 E0.05760 F6000
+G1 X119.142 Y119.142 Z1.828 E0.05760 F6000
+G1 X117.856 Y120.321 Z1.831 E0.05760 F6000
+G1 X116.472 Y121.383 Z1.833 E0.05760 F6000
+G1 X115.000 Y122.321 Z1.836 E0.05760 F6000
+G1 X113.452 Y123.126 Z1.839 E0.05760 F6000
+G1 X111.840 Y123.794 Z1.842 E0.05760 F6000
+G1 X110.176 Y124.319 Z1.844 E0.05760 F6000
+G1 X108.473 Y124.696 Z1.847 E0.05760 F6000
+G1 X106.743 Y124.924 Z1.850 E0.05760 F6000
+G1 X105.000 Y125.000 Z1.853 E0.05760 F6000
+G1 X103.257 Y124.924 Z1.856 E0.05760 F6000
+G1 X101.527 Y124.696 Z1.858 E0.05760 F6000
+G1 X99.824 Y124.319 Z1.861 E0.05760 F6000
+G1 X98.160 Y123.794 Z1.864 E0.05760 F6000
+G1 X96.548 Y123.126 Z1.867 E0.05760 F6000
+G1 X95.000 Y122.321 Z1.869 E0.05760 F6000
+G1 X93.528 Y121.383 Z1.872 E0.05760 F6000
+G1 X92.144 Y120.321 Z1.875 E0.05760 F6000
+G1 X90.858 Y119.142 Z1.878 E0.05760 F6000
+G1 X89.679 Y117.856 Z1.881 E0.05760 F6000
+G1 X88.617 Y116.472 Z1.883 E0.05760 F6000
+G1 X87.679 Y115.000 Z1.886 E0.05760 F6000
+G1 X86.874 Y113.452 Z1.889 E0.05760 F6000
+G1 X86.206 Y111.840 Z1.892 E0.05760 F6000
+G1 X85.681 Y110.176 Z1.894 E0.05760 F6000
+G1 X85.304 Y108.473 Z1.897 E0.05760 F6000
+G1 X85.076 Y106.743 Z1.900 E0.05760 F6000
+G1 X85.000 Y105.000 Z1.903 E0.05760 F6000
+G1 X85.076 Y103.257 Z1.906 E0.05760 F6000
+G1 X85.304 Y101.527 Z1.908 E0.05760 F6000
+G1 X85.681 Y99.824 Z1.911 E0.05760 F6000
+G1 X86.206 Y98.160 Z1.914 E0.05760 F6000
+G1 X86.874 Y96.548 Z1.917 E0.05760 F6000
+G1 X87.679 Y95.000 Z1.919 E0.05760 F6000
+G1 X88.617 Y93.528 Z1.922 E0.05760 F6000
+G1 X89.679 Y92.144 Z1.925 E0.05760 F6000
+G1 X90.858 Y90.858 Z1.928 E0.05760 F6000
+G1 X92.144 Y89.679 Z1.931 E0.05760 F6000
+G1 X93.528 Y88.617 Z1.933 E0.05760 F6000
+G1 X95.000 Y87.679 Z1.936 E0.05760 F6000
+G1 X96.548 Y86.874 Z1.939 E0.05760 F6000
+G1 X98.160 Y86.206 Z1.942 E0.05760 F6000
+G1 X99.824 Y85.681 Z1.944 E0.05760 F6000
+G1 X101.527 Y85.304 Z1.947 E0.05760 F6000
+G1 X103.257 Y85.076 Z1.950 E0.05760 F6000
+G1 X105.000 Y85.000 Z1.953 E0.05760 F6000
+G1 X106.743 Y85.076 Z1.956 E0.05760 F6000
+G1 X108.473 Y85.304 Z1.958 E0.05760 F6000
+G1 X110.176 Y85.681 Z1.961 E0.05760 F6000
+G1 X111.840 Y86.206 Z1.964 E0.05760 F6000
+G1 X113.452 Y86.874 Z1.967 E0.05760 F6000
+G1 X115.000 Y87.679 Z1.969 E0.05760 F6000
+G1 X116.472 Y88.617 Z1.972 E0.05760 F6000
+G1 X117.856 Y89.679 Z1.975 E0.05760 F6000
+G1 X119.142 Y90.858 Z1.978 E0.05760 F6000
+G1 X120.321 Y92.144 Z1.981 E0.05760 F6000
+G1 X121.383 Y93.528 Z1.983 E0.05760 F6000
+G1 X122.321 Y95.000 Z1.986 E0.05760 F6000
+G1 X123.126 Y96.548 Z1.989 E0.05760 F6000
+G1 X123.794 Y98.160 Z1.992 E0.05760 F6000
+G1 X124.319 Y99.824 Z1.994 E0.05760 F6000
+G1 X124.696 Y101.527 Z1.997 E0.05760 F6000
+G1 X124.924 Y103.257 Z2.000 E0.05760 F6000
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z2.003 E0.05760 F2400
+G1 X124.924 Y106.743 Z2.006 E0.05760 F2400
+G1 X124.696 Y108.473 Z2.008 E0.05760 F2400
+G1 X124.319 Y110.176 Z2.011 E0.05760 F2400
+G1 X123.794 Y111.840 Z2.014 E0.05760 F2400
+G1 X123.126 Y113.452 Z2.017 E0.05760 F2400
+G1 X122.321 Y115.000 Z2.019 E0.05760 F2400
+G1 X121.383 Y116.472 Z2.022 E0.05760 F2400
+G1 X120.321 Y117.856 Z2.025 E0.05760 F2400
+G1 X119.142 Y119.142 Z2.028 E0.05760 F2400
+G1 X117.856 Y120.321 Z2.031 E0.05760 F2400
+G1 X116.472 Y121.383 Z2.033 E0.05760 F2400
+G1 X115.000 Y122.321 Z2.036 E0.05760 F2400
+G1 X113.452 Y123.126 Z2.039 E0.05760 F2400
+G1 X111.840 Y123.794 Z2.042 E0.05760 F2400
+G1 X110.176 Y124.319 Z2.044 E0.05760 F2400
+G1 X108.473 Y124.696 Z2.047 E0.05760 F2400
+G1 X106.743 Y124.924 Z2.050 E0.05760 F2400
+G1 X105.000 Y125.000 Z2.053 E0.05760 F2400
+G1 X103.257 Y124.924 Z2.056 E0.05760 F2400
+G1 X101.527 Y124.696 Z2.058 E0.05760 F2400
+G1 X99.824 Y124.319 Z2.061 E0.05760 F2400
+G1 X98.160 Y123.794 Z2.064 E0.05760 F2400
+G1 X96.548 Y123.126 Z2.067 E0.05760 F2400
+G1 X95.000 Y122.321 Z2.069 E0.05760 F2400
+G1 X93.528 Y121.383 Z2.072 E0.05760 F2400
+G1 X92.144 Y120.321 Z2.075 E0.05760 F2400
+G1 X90.858 Y119.142 Z2.078 E0.05760 F2400
+G1 X89.679 Y117.856 Z2.081 E0.05760 F2400
+G1 X88.617 Y116.472 Z2.083 E0.05760 F2400
+G1 X87.679 Y115.000 Z2.086 E0.05760 F2400
+G1 X86.874 Y113.452 Z2.089 E0.05760 F2400
+G1 X86.206 Y111.840 Z2.092 E0.05760 F2400
+G1 X85.681 Y110.176 Z2.094 E0.05760 F2400
+G1 X85.304 Y108.473 Z2.097 E0.05760 F2400
+G1 X85.076 Y106.743 Z2.100 E0.05760 F2400
+G1 X85.000 Y105.000 Z2.103 E0.05760 F2400
+G1 X85.076 Y103.257 Z2.106 E0.05760 F2400
+G1 X85.304 Y101.527 Z2.108 E0.05760 F2400
+G1 X85.681 Y99.824 Z2.111 E0.05760 F2400
+G1 X86.206 Y98.160 Z2.114 E0.05760 F2400
+G1 X86.874 Y96.548 Z2.117 E0.05760 F2400
+G1 X87.679 Y95.000 Z2.119 E0.05760 F2400
+G1 X88.617 Y93.528 Z2.122 E0.05760 F2400
+G1 X89.679 Y92.144 Z2.125 E0.05760 F2400
+G1 X90.858 Y90.858 Z2.128 E0.05760 F2400
+G1 X92.144 Y89.679 Z2.131 E0.05760 F2400
+G1 X93.528 Y88.617 Z2.133 E0.05760 F2400
+G1 X95.000 Y87.679 Z2.136 E0.05760 F2400
+G1 X96.548 Y86.874 Z2.139 E0.05760 F2400
+G1 X98.160 Y86.206 Z2.142 E0.05760 F2400
+G1 X99.824 Y85.681 Z2.144 E0.05760 F2400
+G1 X101.527 Y85.304 Z2.147 E0.05760 F2400
+G1 X103.257 Y85.076 Z2.150 E0.05760 F2400
+G1 X105.000 Y85.000 Z2.153 E0.05760 F2400
+G1 X106.743 Y85.076 Z2.156 E0.05760 F2400
+G1 X108.473 Y85.304 Z2.158 E0.05760 F2400
+G1 X110.176 Y85.681 Z2.161 E0.05760 F2400
+G1 X111.840 Y86.206 Z2.164 E0.05760 F2400
+G1 X113.452 Y86.874 Z2.167 E0.05760 F2400
+G1 X115.000 Y87.679 Z2.169 E0.05760 F2400
+G1 X116.472 Y88.617 Z2.172 E0.05760 F2400
+G1 X117.856 Y89.679 Z2.175 E0.05760 F2400
+G1 X119.142 Y90.858 Z2.178 E0.05760 F2400
+G1 X120.321 Y92.144 Z2.181 E0.05760 F2400
+G1 X121.383 Y93.528 Z2.183 E0.05760 F2400
+G1 X122.321 Y95.000 Z2.186 E0.05760 F2400
+G1 X123.126 Y96.548 Z2.189 E0.05760 F2400
+G1 X123.794 Y98.160 Z2.192 E0.05760 F2400
+G1 X124.319 Y99.824 Z2.194 E0.05760 F2400
+G1 X124.696 Y101.527 Z2.197 E0.05760 F2400
+G1 X124.924 Y103.257 Z2.200 E0.05760 F2400
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z2.203 E0.05760 F6000
+G1 X124.924 Y106.743 Z2.206 E0.05760 F6000
+G1 X124.696 Y108.473 Z2.208 E0.05760 F6000
+G1 X124.319 Y110.176 Z2.211 E0.05760 F6000
+G1 X123.794 Y111.840 Z2.214 E0.05760 F6000
+G1 X123.126 Y113.452 Z2.217 E0.05760 F6000
+G1 X122.321 Y115.000 Z2.219 E0.05760 F6000
+G1 X121.383 Y116.472 Z2.222 E0.05760 F6000
+G1 X120.321 Y117.856 Z2.225 E0.05760 F6000
+G1 X119.142 Y119.142 Z2.228 E0.05760 F6000
+G1 X117.856 Y120.321 Z2.231 E0.05760 F6000
+G1 X116.472 Y121.383 Z2.233 E0.05760 F6000
+G1 X115.000 Y122.321 Z2.236 E0.05760 F6000
+G1 X113.452 Y123.126 Z2.239 E0.05760 F6000
+G1 X111.840 Y123.794 Z2.242 E0.05760 F6000
+G1 X110.176 Y124.319 Z2.244 E0.05760 F6000
+G1 X108.473 Y124.696 Z2.247 E0.05760 F6000
+G1 X106.743 Y124.924 Z2.250 E0.05760 F6000
+G1 X105.000 Y125.000 Z2.253 E0.05760 F6000
+G1 X103.257 Y124.924 Z2.256 E0.05760 F6000
+G1 X101.527 Y124.696 Z2.258 E0.05760 F6000
+G1 X99.824 Y124.319 Z2.261 E0.05760 F6000
+G1 X98.160 Y123.794 Z2.264 E0.05760 F6000
+G1 X96.548 Y123.126 Z2.267 E0.05760 F6000
+G1 X95.000 Y122.321 Z2.269 E0.05760 F6000
+G1 X93.528 Y121.383 Z2.272 E0.05760 F6000
+G1 X92.144 Y120.321 Z2.275 E0.05760 F6000
+G1 X90.858 Y119.142 Z2.278 E0.05760 F6000
+G1 X89.679 Y117.856 Z2.281 E0.05760 F6000
+G1 X88.617 Y116.472 Z2.283 E0.05760 F6000
+G1 X87.679 Y115.000 Z2.286 E0.05760 F6000
+G1 X86.874 Y113.452 Z2.289 E0.05760 F6000
+G1 X86.206 Y111.840 Z2.292 E0.05760 F6000
+G1 X85.681 Y110.176 Z2.294 E0.05760 F6000
+G1 X85.304 Y108.473 Z2.297 E0.05760 F6000
+G1 X85.076 Y106.743 Z2.300 E0.05760 F6000
+G1 X85.000 Y105.000 Z2.303 E0.05760 F6000
+G1 X85.076 Y103.257 Z2.306 E0.05760 F6000
+G1 X85.304 Y101.527 Z2.308 E0.05760 F6000
+G1 X85.681 Y99.824 Z2.311 E0.05760 F6000
+G1 X86.206 Y98.160 Z2.314 E0.05760 F6000
+G1 X86.874 Y96.548 Z2.317 E0.05760 F6000
+G1 X87.679 Y95.000 Z2.319 E0.05760 F6000
+G1 X88.617 Y93.528 Z2.322 E0.05760 F6000
+G1 X89.679 Y92.144 Z2.325 E0.05760 F6000
+G1 X90.858 Y90.858 Z2.328 E0.05760 F6000
+G1 X92.144 Y89.679 Z2.331 E0.05760 F6000
+G1 X93.528 Y88.617 Z2.333 E0.05760 F6000
+G1 X95.000 Y87.679 Z2.336 E0.05760 F6000
+G1 X96.548 Y86.874 Z2.339 E0.05760 F6000
+G1 X98.160 Y86.206 Z2.342 E0.05760 F6000
+G1 X99.824 Y85.681 Z2.344 E0.05760 F6000
+G1 X101.527 Y85.304 Z2.347 E0.05760 F6000
+G1 X103.257 Y85.076 Z2.350 E0.05760 F6000
+G1 X105.000 Y85.000 Z2.353 E0.05760 F6000
+G1 X106.743 Y85.076 Z2.356 E0.05760 F6000
+G1 X108.473 Y85.304 Z2.358 E0.05760 F6000
+G1 X110.176 Y85.681 Z2.361 E0.05760 F6000
+G1 X111.840 Y86.206 Z2.364 E0.05760 F6000
+G1 X113.452 Y86.874 Z2.367 E0.05760 F6000
+G1 X115.000 Y87.679 Z2.369 E0.05760 F6000
+G1 X116.472 Y88.617 Z2.372 E0.05760 F6000
+G1 X117.856 Y89.679 Z2.375 E0.05760 F6000
+G1 X119.142 Y90.858 Z2.378 E0.05760 F6000
+G1 X120.321 Y92.144 Z2.381 E0.05760 F6000
+G1 X121.383 Y93.528 Z2.383 E0.05760 F6000
+G1 X122.321 Y95.000 Z2.386 E0.05760 F6000
+G1 X123.126 Y96.548 Z2.389 E0.05760 F6000
+G1 X123.794 Y98.160 Z2.392 E0.05760 F6000
+G1 X124.319 Y99.824 Z2.394 E0.05760 F6000
+G1 X124.696 Y101.527 Z2.397 E0.05760 F6000
+G1 X124.924 Y103.257 Z2.400 E0.05760 F6000
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
+G1 X125.000 Y105.000 Z2.403 E0.05760 F2400
+G1 X124.924 Y106.743 Z2.406 E0.05760 F2400
+G1 X124.696 Y108.473 Z2.408 E0.05760 F2400
+G1 X124.319 Y110.176 Z2.411 E0.05760 F2400
+G1 X123.794 Y111.840 Z2.414 E0.05760 F2400
+G1 X123.126 Y113.452 Z2.417 E0.05760 F2400
+G1 X122.321 Y115.000 Z2.419 E0.05760 F2400
+G1 X121.383 Y116.472 Z2.422 E0.05760 F2400
+G1 X120.321 Y117.856 Z2.425 E0.05760 F2400
+G1 X119.142 Y119.142 Z2.428 E0.05760 F2400
+G1 X117.856 Y120.321 Z2.431 E0.05760 F2400
+G1 X116.472 Y121.383 Z2.433 E0.05760 F2400
+G1 X115.000 Y122.321 Z2.436 E0.05760 F2400
+G1 X113.452 Y123.126 Z2.439 E0.05760 F2400
+G1 X111.840 Y123.794 Z2.442 E0.05760 F2400
+G1 X110.176 Y124.319 Z2.444 E0.05760 F2400
+G1 X108.473 Y124.696 Z2.447 E0.05760 F2400
+G1 X106.743 Y124.924 Z2.450 E0.05760 F2400
+G1 X105.000 Y125.000 Z2.453 E0.05760 F2400
+G1 X103.257 Y124.924 Z2.456 E0.05760 F2400
+G1 X101.527 Y124.696 Z2.458 E0.05760 F2400
+G1 X99.824 Y124.319 Z2.461 E0.05760 F2400
+G1 X98.160 Y123.794 Z2.464 E0.05760 F2400
+G1 X96.548 Y123.126 Z2.467 E0.05760 F2400
+G1 X95.000 Y122.321 Z2.469 E0.05760 F2400
+G1 X93.528 Y121.383 Z2.472 E0.05760 F2400
+G1 X92.144 Y120.321 Z2.475 E0.05760 F2400
+G1 X90.858 Y119.142 Z2.478 E0.05760 F2400
+G1 X89.679 Y117.856 Z2.481 E0.05760 F2400
+G1 X88.617 Y116.472 Z2.483 E0.05760 F2400
+G1 X87.679 Y115.000 Z2.486 E0.05760 F2400
+G1 X86.874 Y113.452 Z2.489 E0.05760 F2400
+G1 X86.206 Y111.840 Z2.492 E0.05760 F2400
+G1 X85.681 Y110.176 Z2.494 E0.05760 F2400
+G1 X85.304 Y108.473 Z2.497 E0.05760 F2400
+G1 X85.076 Y106.743 Z2.500 E0.05760 F2400
+G1 X85.000 Y105.000 Z2.503 E0.05760 F2400
+G1 X85.076 Y103.257 Z2.506 E0.05760 F2400
+G1 X85.304 Y101.527 Z2.508 E0.05760 F2400
+G1 X85.681 Y99.824 Z2.511 E0.05760 F2400
+G1 X86.206 Y98.160 Z2.514 E0.05760 F2400
+G1 X86.874 Y96.548 Z2.517 E0.05760 F2400
+G1 X87.679 Y95.000 Z2.519 E0.05760 F2400
+G1 X88.617 Y93.528 Z2.522 E0.05760 F2400
+G1 X89.679 Y92.144 Z2.525 E0.05760 F2400
+G1 X90.858 Y90.858 Z2.528 E0.05760 F2400
+G1 X92.144 Y89.679 Z2.531 E0.05760 F2400
+G1 X93.528 Y88.617 Z2.533 E0.05760 F2400
+G1 X95.000 Y87.679 Z2.536 E0.05760 F2400
+G1 X96.548 Y86.874 Z2.539 E0.05760 F2400
+G1 X98.160 Y86.206 Z2.542 E0.05760 F2400
+G1 X99.824 Y85.681 Z2.544 E0.05760 F2400
+G1 X101.527 Y85.304 Z2.547 E0.05760 F2400
+G1 X103.257 Y85.076 Z2.550 E0.05760 F2400
+G1 X105.000 Y85.000 Z2.553 E0.05760 F2400
+G1 X106.743 Y85.076 Z2.556 E0.05760 F2400
+G1 X108.473 Y85.304 Z2.558 E0.05760 F2400
+G1 X110.176 Y85.681 Z2.561 E0.05760 F2400
+G1 X111.840 Y86.206 Z2.564 E0.05760 F2400
+G1 X113.452 Y86.874 Z2.567 E0.05760 F2400
+G1 X115.000 Y87.679 Z2.569 E0.05760 F2400
+G1 X116.472 Y88.617 Z2.572 E0.05760 F2400
+G1 X117.856 Y89.679 Z2.575 E0.05760 F2400
+G1 X119.142 Y90.858 Z2.578 E0.05760 F2400
+G1 X120.321 Y92.144 Z2.581 E0.05760 F2400
+G1 X121.383 Y93.528 Z2.583 E0.05760 F2400
+G1 X122.321 Y95.000 Z2.586 E0.05760 F2400
+G1 X123.126 Y96.548 Z2.589 E0.05760 F2400
+G1 X123.794 Y98.160 Z2.592 E0.05760 F2400
+G1 X124.319 Y99.824 Z2.594 E0.05760 F2400
+G1 X124.696 Y101.527 Z2.597 E0.05760 F2400
+G1 X124.924 Y103.257 Z2.600 E0.05760 F2400
+G1 E-0.8 F2100
+G1 X129.000 Y105.000 F9000
+G1 E0.8 F2100
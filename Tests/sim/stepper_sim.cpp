@@ -0,0 +1,356 @@
+/**
+ * @file
+ * @brief Host stepper interrupt replay harness.
+ *
+ * Replays a block stream recorded by planner_sim --record through the unmodified
+ * stepper interrupt of Firmware/stepper.cpp (isr(), stepper_tick_lowres(),
+ * stepper_tick_highres(), calc_timer() and the Linear Advance ticks)
+ * on a simulated timer 1, and reports
+ * - per axis step timestamps (--steps file.csv),
+ * - per axis histograms of the inter-step jitter, that is the difference
+ *   of two consecutive step intervals,
+ * - an estimate of the CPU cycles of each interrupt invocation (--isr file.csv),
+ * - the blocks, which pushed calc_timer() into its double / quad stepping modes.
+ *
+ * The harness compiles stepper.cpp into itself to observe its internal state.
+ * The timer 1 runs at 2MHz in the CTC mode, an interrupt is invoked every OCR1A + 1 ticks.
+ *
+ * The cycle counts are not measured, they are estimated by a simple cost model,
+ * see IsrCost. Its base values are the interrupt durations measured on the printer
+ * and noted in isr(): 13.38-14.63us at the steady state, 25.12us during acceleration
+ * / deceleration. If the estimated interrupt duration does not fit the next timer
+ * interval, the next interrupt is postponed the same way the end of TIMER1_COMPA_vect
+ * does it with the real TCNT1, and the event is counted as an interrupt overrun.
+ *
+ * Usage: stepper_sim [--steps steps.csv] [--isr isr.csv] blocks.txt
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "stepper.cpp"
+#include "block_stream.h"
+#include "sim_avr.h"
+#include "sim_marlin.h"
+
+//===========================================================================
+//=============================planner.cpp replacement======================
+//===========================================================================
+
+block_t block_buffer[BLOCK_BUFFER_SIZE];
+volatile unsigned char block_buffer_head;
+volatile unsigned char block_buffer_tail;
+
+//===========================================================================
+//=============================stubs of the rest of the firmware============
+//===========================================================================
+
+const char MSG_ENDSTOPS_HIT[] PROGMEM = "endstops hit: ";
+bool axis_known_position[3];
+void serial_echopair_P(const char *s_P, float v) { fprintf(stderr, "%s%f\n", s_P, v); }
+void manage_heater() {}
+
+void init_force_z() {}
+void disable_force_z() {}
+
+uint8_t tmc2130_sg_homing_axes_mask;
+void tmc2130_init(bool) {}
+void tmc2130_st_isr() {}
+bool tmc2130_update_sg() { return false; }
+
+int16_t fsensor_chunk_len = 0x7fff;
+void fsensor_st_block_begin(block_t*) {}
+void fsensor_st_block_chunk(block_t*, int) {}
+
+//===========================================================================
+//=============================cost model ===================================
+//===========================================================================
+
+//! Estimated CPU cycles (16MHz) of the stepper interrupt paths.
+//! The steady state and the acceleration values are taken from the measurements noted in isr(),
+//! the rest are rough estimates of the instruction counts.
+namespace IsrCost
+{
+    //! Interrupt with an empty planner queue.
+    static const uint32_t idle = 80;
+    //! stepper_next_block(): calc_timer(), Bresenham counters and direction pins.
+    static const uint32_t block_begin = 250;
+    //! Steady state tick with a single step loop, 13.38us.
+    static const uint32_t steady = 214;
+    //! Acceleration / deceleration tick or the 1st steady state tick: MultiU24X24toH16() and calc_timer(), 25.12us.
+    static const uint32_t ramp = 402;
+    //! Each additional step loop: MSerial.checkRx() and four Bresenham counter updates.
+    static const uint32_t step_loop = 60;
+    //! Each step pulse including the count_position update.
+    static const uint32_t step_pulse = 16;
+    //! Linear Advance only interrupt, without the extruder pulses.
+    static const uint32_t la_tick = 60;
+    //! Scheduling of the Linear Advance ticks at the end of isr().
+    static const uint32_t la_schedule = 120;
+}
+
+static const uint8_t TICKS_PER_US = 2;
+static const uint8_t CYCLES_PER_TICK = F_CPU / 2000000;
+static const uint8_t JITTER_BUCKETS = 16;
+
+//===========================================================================
+//=============================replay =======================================
+//===========================================================================
+
+static struct
+{
+    uint32_t isr_count;
+    uint32_t isr_overruns;
+    uint64_t isr_cycles;
+    uint32_t isr_cycles_max;
+    uint64_t steps[NUM_AXIS];
+    //! Histogram of the jitter in timer ticks, bucket 0 for zero, bucket n for [2^(n-1), 2^n).
+    uint32_t jitter[NUM_AXIS][JITTER_BUCKETS];
+} s_stats;
+
+//! Per axis step timing, reset when the queue runs empty.
+static struct
+{
+    bool     valid;
+    uint64_t last_time;
+    //! Last step interval in timer ticks, -1 if not known yet.
+    int64_t  last_interval;
+} s_axis[NUM_AXIS];
+
+//! Index of the block in the stream for each slot of block_buffer.
+static uint32_t s_block_index[BLOCK_BUFFER_SIZE];
+struct BlockInfo
+{
+    unsigned long nominal_rate;
+    //! Maximum step_loops reached while executing the block.
+    uint8_t step_loops;
+};
+//! Per block of the stream.
+static std::vector<BlockInfo> s_blocks;
+
+static void axis_timing_reset()
+{
+    for (uint8_t axis = 0; axis < NUM_AXIS; ++ axis) {
+        s_axis[axis].valid = false;
+        s_axis[axis].last_interval = -1;
+    }
+}
+
+static void axis_step(uint8_t axis, uint64_t time)
+{
+    ++ s_stats.steps[axis];
+    if (s_axis[axis].valid) {
+        const int64_t interval = int64_t(time - s_axis[axis].last_time);
+        if (s_axis[axis].last_interval >= 0) {
+            const uint64_t jitter = std::llabs(interval - s_axis[axis].last_interval);
+            uint8_t bucket = 0;
+            while (bucket + 1 < JITTER_BUCKETS && (jitter >> bucket) != 0)
+                ++ bucket;
+            ++ s_stats.jitter[axis][bucket];
+        }
+        s_axis[axis].last_interval = interval;
+    }
+    s_axis[axis].valid = true;
+    s_axis[axis].last_time = time;
+}
+
+//! Fill the planner queue from the block stream.
+static void queue_fill(FILE *in, uint32_t &blocks_read)
+{
+    while (! planner_queue_full()) {
+        block_t *block = &block_buffer[block_buffer_head];
+        if (! block_stream_read(in, block))
+            break;
+        s_block_index[block_buffer_head] = blocks_read ++;
+        BlockInfo info = { block->nominal_rate, 0 };
+        s_blocks.push_back(info);
+        block_buffer_head = (block_buffer_head + 1) & (BLOCK_BUFFER_SIZE - 1);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = NULL;
+    const char *steps_path = NULL;
+    const char *isr_path = NULL;
+    for (int i = 1; i < argc; ++ i) {
+        std::string arg = argv[i];
+        if (arg == "--steps" && i + 1 < argc)
+            steps_path = argv[++ i];
+        else if (arg == "--isr" && i + 1 < argc)
+            isr_path = argv[++ i];
+        else
+            path = argv[i];
+    }
+    if (path == NULL) {
+        std::cerr << "Usage: stepper_sim [--steps steps.csv] [--isr isr.csv] blocks.txt" << std::endl;
+        return 1;
+    }
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+    }
+    FILE *steps_out = NULL;
+    FILE *isr_out = NULL;
+    if ((steps_path != NULL && (steps_out = fopen(steps_path, "w")) == NULL) ||
+        (isr_path != NULL && (isr_out = fopen(isr_path, "w")) == NULL)) {
+        std::cerr << "Cannot create the output file" << std::endl;
+        return 1;
+    }
+    if (steps_out != NULL)
+        fputs("time_us,axis,steps\n", steps_out);
+    if (isr_out != NULL)
+        fputs("time_us,cycles,block,step_loops,phase\n", isr_out);
+
+    sim_avr_reset();
+    sim_marlin_reset();
+    axis_timing_reset();
+    OCR1A = 2000;
+
+    uint32_t blocks_read = 0;
+    // Simulated time in timer 1 ticks.
+    uint64_t time = 0;
+    queue_fill(in, blocks_read);
+    while (blocks_queued() || current_block != NULL) {
+        const block_t *block_before = current_block;
+        const uint8_t step_loops_nominal_before = step_loops_nominal;
+        long position_before[NUM_AXIS];
+        for (uint8_t axis = 0; axis < NUM_AXIS; ++ axis)
+            position_before[axis] = count_position[axis];
+#ifdef LIN_ADVANCE
+        const int16_t e_steps_before = e_steps;
+#endif
+        const uint32_t events_before = step_events_completed.wide;
+
+        TCNT1 = 0;
+        TIMER1_COMPA_vect();
+
+        // Which block has been serviced? It may have been retired already, its slot is still valid.
+        const block_t *block = block_before;
+        if (block == NULL)
+            block = (current_block != NULL) ? current_block :
+                (block_buffer_tail != block_buffer_head || step_events_completed.wide != events_before) ?
+                    &block_buffer[(block_buffer_tail + BLOCK_BUFFER_SIZE - 1) & (BLOCK_BUFFER_SIZE - 1)] : NULL;
+        const bool main_isr = block != NULL && (block != block_before || step_events_completed.wide != events_before);
+
+        uint32_t pulses = 0;
+        for (uint8_t axis = 0; axis < NUM_AXIS; ++ axis) {
+            const long delta = count_position[axis] - position_before[axis];
+            const long n = std::labs(delta);
+            for (long i = 0; i < n; ++ i)
+                axis_step(axis, time);
+            pulses += n;
+            if (steps_out != NULL && delta != 0)
+                fprintf(steps_out, "%.1f,%c,%ld\n", double(time) / TICKS_PER_US, "XYZE"[axis], delta);
+        }
+
+        uint32_t cycles;
+        const char *phase;
+        uint8_t loops = 0;
+        if (block == NULL) {
+            cycles = IsrCost::idle;
+            phase = "idle";
+            axis_timing_reset();
+        } else if (! main_isr) {
+            cycles = IsrCost::la_tick;
+            phase = "la";
+        } else {
+            loops = step_loops;
+            const uint32_t events = step_events_completed.wide;
+            const bool ramp = events <= (unsigned long)block->accelerate_until || events > (unsigned long)block->decelerate_after ||
+                (step_loops_nominal != 0 && (step_loops_nominal_before == 0 || block != block_before));
+            cycles = (ramp ? IsrCost::ramp : IsrCost::steady) + (loops - 1) * IsrCost::step_loop;
+            phase = (events <= (unsigned long)block->accelerate_until) ? "accel" :
+                (events > (unsigned long)block->decelerate_after) ? "decel" : "cruise";
+            if (block != block_before)
+                cycles += IsrCost::block_begin;
+#ifdef LIN_ADVANCE
+            if (e_steps != 0 && block->use_advance_lead)
+                cycles += IsrCost::la_schedule;
+#endif
+            uint8_t &block_loops = s_blocks[s_block_index[block - block_buffer]].step_loops;
+            if (loops > block_loops)
+                block_loops = loops;
+        }
+#ifdef LIN_ADVANCE
+        // The Linear Advance pulses are not counted by count_position.
+        if (e_steps_before > e_steps)
+            pulses += e_steps_before - e_steps;
+#endif
+        cycles += pulses * IsrCost::step_pulse;
+
+        ++ s_stats.isr_count;
+        s_stats.isr_cycles += cycles;
+        if (cycles > s_stats.isr_cycles_max)
+            s_stats.isr_cycles_max = cycles;
+        if (isr_out != NULL)
+            fprintf(isr_out, "%.1f,%u,%d,%u,%s\n", double(time) / TICKS_PER_US, cycles,
+                (block == NULL) ? -1 : int(s_block_index[block - block_buffer]), loops, phase);
+
+        // Don't run the ISR faster than possible, the same as the end of TIMER1_COMPA_vect() with the estimated TCNT1.
+        const uint16_t elapsed = uint16_t((cycles + CYCLES_PER_TICK - 1) / CYCLES_PER_TICK);
+        if (OCR1A < elapsed + 16) {
+            OCR1A = elapsed + 16;
+            ++ s_stats.isr_overruns;
+        }
+        time += uint32_t(OCR1A) + 1;
+        queue_fill(in, blocks_read);
+    }
+    fclose(in);
+    if (steps_out != NULL)
+        fclose(steps_out);
+    if (isr_out != NULL)
+        fclose(isr_out);
+
+    const double time_s = double(time) / (TICKS_PER_US * 1000000.);
+    printf("blocks replayed:      %u\n", blocks_read);
+    printf("simulated time:       %.3f s\n", time_s);
+    printf("isr invocations:      %u\n", s_stats.isr_count);
+    printf("isr cycles mean:      %.1f\n", s_stats.isr_count ? double(s_stats.isr_cycles) / s_stats.isr_count : 0.);
+    printf("isr cycles max:       %u\n", s_stats.isr_cycles_max);
+    printf("isr cpu load:         %.1f %%\n", time ? 100. * s_stats.isr_cycles / (double(time) * CYCLES_PER_TICK) : 0.);
+    printf("isr overruns:         %u\n", s_stats.isr_overruns);
+    printf("steps:                X %llu, Y %llu, Z %llu, E %llu\n",
+        (unsigned long long)s_stats.steps[X_AXIS], (unsigned long long)s_stats.steps[Y_AXIS],
+        (unsigned long long)s_stats.steps[Z_AXIS], (unsigned long long)s_stats.steps[E_AXIS]);
+
+    printf("\ninter-step jitter [us]      X          Y          Z          E\n");
+    uint8_t last_bucket = 0;
+    for (uint8_t bucket = 0; bucket < JITTER_BUCKETS; ++ bucket)
+        for (uint8_t axis = 0; axis < NUM_AXIS; ++ axis)
+            if (s_stats.jitter[axis][bucket])
+                last_bucket = bucket;
+    for (uint8_t bucket = 0; bucket <= last_bucket; ++ bucket) {
+        if (bucket == 0)
+            printf("  0                ");
+        else if (bucket + 1 == JITTER_BUCKETS)
+            printf("  %7.1f -         ", double(1 << (bucket - 1)) / TICKS_PER_US);
+        else
+            printf("  %7.1f - %7.1f", double(1 << (bucket - 1)) / TICKS_PER_US, double(1 << bucket) / TICKS_PER_US);
+        for (uint8_t axis = 0; axis < NUM_AXIS; ++ axis)
+            printf(" %10u", s_stats.jitter[axis][bucket]);
+        printf("\n");
+    }
+
+    uint32_t blocks_x2 = 0;
+    uint32_t blocks_x4 = 0;
+    for (const BlockInfo &info : s_blocks) {
+        if (info.step_loops == 2)
+            ++ blocks_x2;
+        else if (info.step_loops == 4)
+            ++ blocks_x4;
+    }
+    printf("\nblocks stepping 2x:   %u\n", blocks_x2);
+    printf("blocks stepping 4x:   %u\n", blocks_x4);
+    uint32_t listed = 0;
+    for (size_t i = 0; i < s_blocks.size() && listed < 20; ++ i)
+        if (s_blocks[i].step_loops > 1) {
+            printf("  block %u: %ux, nominal rate %lu steps/s\n", unsigned(i), s_blocks[i].step_loops, s_blocks[i].nominal_rate);
+            ++ listed;
+        }
+    return 0;
+}
@@ -0,0 +1,550 @@
+/**
+ * @file
+ * @brief Host thermal plant simulator of the hotend and the heated bed.
+ *
+ * Runs the unmodified heater control of Firmware/temperature.cpp (PID_autotune(),
+ * manage_heater(), temp_runaway_check(), the MINTEMP / MAXTEMP checks and the
+ * soft PWM of the temperature interrupt) and the ADC sampling of Firmware/adc.c
+ * against a first order plus dead time model of each heater, in simulated time.
+ *
+ * Every 1.024ms of the simulated time the ADC register is loaded with the conversion
+ * result of the channel selected by the multiplexer and the temperature interrupt
+ * (TIMER2_COMPB_vect) is invoked. The raw values are obtained from the firmware's own
+ * thermistor tables. The hotend power is taken from the state of the heater pin driven
+ * by the soft PWM, the bed power from soft_pwm_bed (the hardware PWM of timer 0
+ * is not simulated).
+ *
+ * Each scenario is run in its own process, so that the static state of the heater
+ * control starts from the power-on defaults. The process exits with a non-zero
+ * status if the firmware did not react as expected.
+ *
+ * Usage: thermal_sim [--trace trace.csv] scenario
+ *
+ * Scenarios:
+ * - autotune, autotune_bed - relay autotuning, the tuned gains are then verified by a heatup.
+ * - heatup, heatup_bed - PID control with the default gains, checks the overshoot and the steady state error.
+ * - extrusion - a minute of a high flow at 215C with and without the extrusion rate feed-forward (M301 C),
+ *   the feed-forward is expected to reduce the temperature drop by 40% at least, the rest is the ripple
+ *   of the soft PWM and the ADC resolution.
+ * - preheat_runaway - the heater cartridge is disconnected, "PREHEAT ERROR" is expected.
+ * - runaway - the thermistor falls out of the heater block at the target temperature, "THERMAL RUNAWAY" is expected.
+ * - runaway_bed - the bed heater fails at the target temperature, "BED THERMAL RUNAWAY" is expected.
+ * - mintemp - the thermistor wire breaks, "Err: MINTEMP" is expected.
+ * - maxtemp - the heater MOSFET is shorted, "Err: MAXTEMP" is expected.
+ * - maxtemp_bed - the bed MOSFET is shorted, "Err: MAXTEMP BED" is expected.
+ */
+
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+
+// The interrupt enable / disable instructions of the temperature interrupt have no host equivalent.
+#define asm(code)
+#include "temperature.cpp"
+#undef asm
+#include "sim_avr.h"
+#include "sim_marlin.h"
+
+typedef std::chrono::steady_clock host_clock;
+
+//===========================================================================
+//=============================stubs of the rest of the firmware============
+//===========================================================================
+
+// Alert shown on the LCD, the outcome of a fault scenario.
+static std::string s_alert;
+static uint64_t s_alert_us;
+static bool s_stopped;
+static bool s_killed;
+
+void lcd_setalertstatuspgm(const char *message)
+{
+    if (s_alert.empty()) {
+        s_alert = message;
+        s_alert_us = sim_clock_us();
+    }
+}
+void lcd_updatestatuspgm(const char *message) { lcd_setalertstatuspgm(message); }
+void lcd_reset_alert_level() {}
+uint8_t get_message_level() { return 0; }
+void lcd_buttons_update() {}
+void lcd_print_stop() {}
+uint8_t menu_block_entering_on_serious_errors;
+
+bool IsStopped() { return s_stopped; }
+void Stop() { s_stopped = true; }
+void kill(const char *full_screen_message, unsigned char id)
+{
+    fprintf(stderr, "kill(%s, %d)\n", full_screen_message ? full_screen_message : "", id);
+    s_killed = true;
+}
+void quickStop() {}
+void cmdqueue_reset() {}
+void host_keepalive() {}
+void prusa_statistics(int, uint8_t) {}
+void Sound_MakeCustom(uint16_t, uint16_t, bool) {}
+void timer0_init() {}
+void babystep(const uint8_t, const bool) {}
+
+bool SdBaseFile::close() { return true; }
+CardReader::CardReader() {}
+void CardReader::closefile(bool) {}
+CardReader card;
+
+bool axis_known_position[3];
+block_t block_buffer[BLOCK_BUFFER_SIZE];
+volatile unsigned char block_buffer_head;
+volatile unsigned char block_buffer_tail;
+//! Extrusion rate of the moves queued by the extrusion scenario [mm^3/s]
+static float s_queued_flow;
+float planner_extrusion_rate() { return s_queued_flow; }
+
+bool cancel_heatup;
+CustomMsg custom_message_type = CustomMsg::Status;
+LcdCommands lcd_commands_type = LcdCommands::Idle;
+uint8_t farm_mode;
+unsigned int heating_status;
+bool isPrintPaused;
+bool mmu_print_saved;
+bool saved_printing;
+
+const char MSG_FANCHECK_EXTRUDER[] PROGMEM = "Err: EXTR. FAN ERROR";
+const char MSG_FANCHECK_PRINT[] PROGMEM = "Err: PRINT FAN ERROR";
+bool fans_check_enabled = false;
+bool fan_state[2];
+int fan_edge_counter[2];
+int fan_speed[2];
+
+//===========================================================================
+//=============================plant model ==================================
+//===========================================================================
+
+//! Period of the temperature interrupt, timer 2 at 16MHz / 64 / 256.
+static const uint32_t TICK_US = 1024;
+static const float TICK_S = TICK_US * 1e-6f;
+static const float AMBIENT = 22.f;
+
+//! First order plus dead time model of a heater.
+//! The temperature approaches ambient + gain * power with the time constant tau,
+//! a change of the power takes effect after the dead time.
+struct Plant
+{
+    //! Steady state temperature rise at the full power [C]
+    float gain;
+    //! [s]
+    float tau;
+    //! [s]
+    float dead_time;
+    float temperature;
+    //! Power drawn by the melting of the filament, a fraction of the full power.
+    float load;
+    //! Power of the last dead_time seconds, a ring buffer of the ticks.
+    std::vector<float> delay;
+    size_t delay_pos;
+
+    Plant(float gain, float tau, float dead_time) : gain(gain), tau(tau), dead_time(dead_time)
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        temperature = AMBIENT;
+        load = 0.f;
+        delay.assign(size_t(dead_time / TICK_S + 0.5f) + 1, 0.f);
+        delay_pos = 0;
+    }
+
+    //! @param power 0 to 1
+    void step(float power)
+    {
+        const float delayed = delay[delay_pos];
+        delay[delay_pos] = power;
+        if (++ delay_pos == delay.size())
+            delay_pos = 0;
+        temperature += TICK_S / tau * (gain * (delayed - load) - (temperature - AMBIENT));
+    }
+};
+
+//! E3D V6 hotend with the 40W cartridge, full power reaches 215C in about 80s.
+static Plant s_hotend(530.f, 173.f, 3.f);
+//! Power of the hotend heater [W] and the energy melting the filament [J/mm^3], PLA from the ambient to 215C.
+static const float HOTEND_POWER = 40.f;
+static const float MELT_ENERGY = 0.45f;
+//! MK52 heated bed, full power reaches 60C in about 2 minutes, 100C in about 6.5 minutes.
+static Plant s_bed(120.f, 400.f, 6.f);
+
+//! Temperature of the hotend thermistor, lagging behind the heater block.
+static float s_hotend_sensor = AMBIENT;
+//! Time constants of the thermistor in the heater block and out of it [s]
+static const float SENSOR_TAU = 1.f;
+static const float SENSOR_LOOSE_TAU = 30.f;
+
+//! Injected faults
+static struct
+{
+    //! Heater cartridge disconnected.
+    bool heater_open;
+    //! Heater MOSFET shorted, the heater is always on.
+    bool heater_stuck;
+    //! Thermistor fell out of the heater block, it cools down to the ambient temperature.
+    bool sensor_loose;
+    //! Broken thermistor wire, the input is pulled up to the full scale.
+    bool sensor_open;
+    //! Bed heater disconnected.
+    bool bed_open;
+    //! Bed MOSFET shorted.
+    bool bed_stuck;
+} s_fault;
+
+//! Maximum real temperature of the heater block.
+static float s_hotend_peak;
+
+static FILE *s_trace;
+
+//! Raw value of a single conversion of a thermistor at the given temperature.
+//! Inverse of thermistor_celsius(), the tables are sorted by the raw value scaled by OVERSAMPLENR.
+static uint16_t thermistor_raw(const short (*table)[2], uint8_t len, float celsius)
+{
+    float raw;
+    if (celsius >= table[0][1])
+        raw = table[0][0];
+    else if (celsius <= table[len - 1][1])
+        raw = table[len - 1][0];
+    else {
+        uint8_t i = 1;
+        while (table[i][1] > celsius)
+            ++ i;
+        const float t = (celsius - table[i - 1][1]) / float(table[i][1] - table[i - 1][1]);
+        raw = table[i - 1][0] + t * (table[i][0] - table[i - 1][0]);
+    }
+    const int sample = int(raw / OVERSAMPLENR + 0.5f);
+    return uint16_t(constrain(sample, 0, 1023));
+}
+
+static uint8_t adc_selected_index()
+{
+    const uint8_t chan = (ADMUX & 0x07) | ((ADCSRB & (1 << MUX5)) ? 0x08 : 0);
+    return BITCOUNT(ADC_CHAN_MSK & ((1 << chan) - 1));
+}
+
+//! Conversion result of the channel selected by the multiplexer.
+static uint16_t adc_sample()
+{
+    const uint8_t index = adc_selected_index();
+    if (index == ADC_PIN_IDX(TEMP_0_PIN))
+        return s_fault.sensor_open ? 1023 : thermistor_raw(HEATER_0_TEMPTABLE, HEATER_0_TEMPTABLE_LEN, s_hotend_sensor);
+    if (index == ADC_PIN_IDX(TEMP_BED_PIN))
+        return thermistor_raw(BEDTEMPTABLE, BEDTEMPTABLE_LEN, s_bed.temperature);
+    if (index == ADC_PIN_IDX(TEMP_PINDA_PIN))
+        return thermistor_raw(BEDTEMPTABLE, BEDTEMPTABLE_LEN, AMBIENT);
+#ifdef AMBIENT_THERMISTOR
+    if (index == ADC_PIN_IDX(TEMP_AMBIENT_PIN))
+        return thermistor_raw(AMBIENTTEMPTABLE, AMBIENTTEMPTABLE_LEN, AMBIENT);
+#endif //AMBIENT_THERMISTOR
+    // The supply voltages are not used by the heater control.
+    return 0;
+}
+
+#define SIM_PIN_HIGH_(IO) ((DIO ## IO ## _WPORT & MASK(DIO ## IO ## _PIN)) != 0)
+#define SIM_PIN_HIGH(IO) SIM_PIN_HIGH_(IO)
+
+//! One period of the temperature interrupt.
+static void sim_tick()
+{
+    ADC = adc_sample();
+    TIMER2_COMPB_vect();
+    sim_clock_advance(TICK_US);
+
+    const bool heater_on = s_fault.heater_stuck || (! s_fault.heater_open && SIM_PIN_HIGH(HEATER_0_PIN));
+    s_hotend.step(heater_on ? 1.f : 0.f);
+    const float bed_power = s_fault.bed_stuck ? 1.f : s_fault.bed_open ? 0.f : soft_pwm_bed / 127.f;
+    s_bed.step(bed_power);
+
+    const float sensor_target = s_fault.sensor_loose ? AMBIENT : s_hotend.temperature;
+    s_hotend_sensor += TICK_S / (s_fault.sensor_loose ? SENSOR_LOOSE_TAU : SENSOR_TAU) * (sensor_target - s_hotend_sensor);
+    if (s_hotend.temperature > s_hotend_peak)
+        s_hotend_peak = s_hotend.temperature;
+
+    if (s_trace && (sim_clock_us() / TICK_US) % 250 == 0)
+        fprintf(s_trace, "%.3f,%.2f,%.2f,%.2f,%d,%.2f,%.2f,%d\n", sim_clock_us() * 1e-6,
+            s_hotend.temperature, s_hotend_sensor, current_temperature[0], target_temperature[0],
+            s_bed.temperature, current_temperature_bed, target_temperature_bed);
+}
+
+//===========================================================================
+//=============================scenarios ====================================
+//===========================================================================
+
+static float sim_seconds()
+{
+    return sim_clock_us() * 1e-6f;
+}
+
+//! Run the main loop: the temperature interrupt and manage_heater().
+//! @param stop_on_alert return as soon as an alert is shown
+static void run(float seconds, bool stop_on_alert = true)
+{
+    const uint64_t end = sim_clock_us() + uint64_t(seconds * 1e6f);
+    while (sim_clock_us() < end && ! (stop_on_alert && ! s_alert.empty())) {
+        sim_tick();
+        manage_heater();
+    }
+}
+
+//! Overshoot and steady state error of a heatup.
+struct Response
+{
+    float peak;
+    float error;
+};
+
+static Response heatup(bool bed, int target, float seconds)
+{
+    if (bed)
+        setTargetBed(target);
+    else
+        setTargetHotend(target, 0);
+    Response response = { 0.f, 0.f };
+    // The peak is measured after the first crossing of the target.
+    const uint64_t end = sim_clock_us() + uint64_t(seconds * 1e6f);
+    bool crossed = false;
+    while (sim_clock_us() < end && s_alert.empty()) {
+        sim_tick();
+        manage_heater();
+        const float t = bed ? current_temperature_bed : current_temperature[0];
+        crossed = crossed || t >= target;
+        if (crossed && t - target > response.peak)
+            response.peak = t - target;
+        // Error over the last minute.
+        if (end - sim_clock_us() < 60000000ULL && fabsf(t - target) > response.error)
+            response.error = fabsf(t - target);
+    }
+    printf("%s heatup to %d: overshoot %.2f C, steady state error %.2f C\n", bed ? "bed" : "hotend", target, response.peak, response.error);
+    return response;
+}
+
+static bool check(bool condition, const char *what)
+{
+    if (! condition)
+        printf("FAILED: %s\n", what);
+    return condition;
+}
+
+//! @param stop the printer is expected to be stopped, not only the print
+static bool expect_alert(const char *expected, float fault_time, bool stop)
+{
+    if (s_alert.empty()) {
+        printf("no alert, expected \"%s\"\n", expected);
+        return false;
+    }
+    printf("alert \"%s\" %.1f s after the fault\n", s_alert.c_str(), s_alert_us * 1e-6f - fault_time);
+    return check(s_alert == expected, "unexpected alert") && check(s_stopped == stop, "printer stop")
+        && check(soft_pwm[0] == 0 && soft_pwm_bed == 0, "heaters not switched off");
+}
+
+static void autotune_idle()
+{
+    sim_tick();
+}
+
+static bool scenario_autotune(bool bed)
+{
+    const int target = bed ? 60 : 215;
+    sim_idle_hook = autotune_idle;
+    PID_autotune(target, bed ? -1 : 0, 5);
+    sim_idle_hook = 0;
+    printf("%s autotune: Kp %.2f, Ki %.4f, Kd %.2f in %.0f s\n", bed ? "bed" : "hotend", _Kp, _Ki, _Kd, sim_seconds());
+    if (! (check(pid_tuning_finished, "autotune not finished") && check(s_alert.empty(), "autotune aborted")
+        && check(_Kp > 0 && _Ki > 0 && _Kd > 0, "no gains")))
+        return false;
+    if (! check((bed ? s_bed.temperature : s_hotend.temperature) < target + 20, "temperature too high"))
+        return false;
+
+    // Cool down and heat up with the tuned gains.
+    if (bed) {
+        cs.bedKp = _Kp;
+        cs.bedKi = scalePID_i(_Ki);
+        cs.bedKd = scalePID_d(_Kd);
+    } else {
+        cs.Kp = _Kp;
+        cs.Ki = scalePID_i(_Ki);
+        cs.Kd = scalePID_d(_Kd);
+    }
+    updatePID();
+    disable_heater();
+    run(bed ? 1800 : 600);
+    const Response response = heatup(bed, target, bed ? 1500 : 600);
+    return check(response.peak < (bed ? 5.f : 10.f), "overshoot") && check(response.error < 1.f, "steady state error");
+}
+
+static bool scenario_heatup(bool bed)
+{
+    const Response response = heatup(bed, bed ? 60 : 215, bed ? 1500 : 600);
+    return check(response.peak < (bed ? 5.f : 10.f), "overshoot") && check(response.error < 1.f, "steady state error");
+}
+
+//! Average heater block temperature over the given time, no moves queued.
+static float average_temperature(float seconds)
+{
+    const uint64_t end = sim_clock_us() + uint64_t(seconds * 1e6f);
+    double sum = 0;
+    uint32_t n = 0;
+    while (sim_clock_us() < end) {
+        sim_tick();
+        manage_heater();
+        sum += s_hotend.temperature;
+        ++ n;
+    }
+    return float(sum / n);
+}
+
+//! Queue moves extruding the given flow, the stepper picks them up after the queue lead time.
+//! The hotend is loaded by the melting once the extrusion starts.
+//! @return maximum drop of the heater block temperature below its average before the extrusion
+static float extrusion(float flow, float seconds)
+{
+    // 8 moves of 0.1s queued.
+    static const float QUEUE_LEAD = 0.8f;
+    const float initial = average_temperature(60.f);
+    const float start = sim_seconds();
+    float drop = 0.f;
+    while (sim_seconds() < start + seconds + 60.f && s_alert.empty()) {
+        const float t = sim_seconds() - start;
+        s_queued_flow = (t < seconds) ? flow : 0.f;
+        s_hotend.load = (t >= QUEUE_LEAD && t < seconds + QUEUE_LEAD) ? flow * MELT_ENERGY / HOTEND_POWER : 0.f;
+        sim_tick();
+        manage_heater();
+        drop = max(drop, initial - s_hotend.temperature);
+    }
+    s_queued_flow = 0.f;
+    s_hotend.load = 0.f;
+    printf("%.0f mm^3/s for %.0f s, Kc %.2f: temperature drop %.2f C\n", flow, seconds, Kc, drop);
+    return drop;
+}
+
+static bool scenario_extrusion()
+{
+    heatup(false, 215, 300);
+    const float feed_forward = Kc;
+    Kc = 0;
+    const float drop = extrusion(15.f, 60.f);
+    Kc = feed_forward;
+    const float drop_feed_forward = extrusion(15.f, 60.f);
+    return check(s_alert.empty(), "alert") && check(drop_feed_forward < drop * 0.6f, "feed-forward");
+}
+
+static bool scenario_preheat_runaway()
+{
+    s_fault.heater_open = true;
+    setTargetHotend(215, 0);
+    run(600);
+    return expect_alert("PREHEAT ERROR", 0, true);
+}
+
+static bool scenario_runaway()
+{
+    heatup(false, 215, 300);
+    const float fault = sim_seconds();
+    s_fault.sensor_loose = true;
+    s_hotend_peak = 0;
+    run(600);
+    // The thermistor does not see the heater block overheating until the runaway is detected.
+    printf("heater block peak %.1f C\n", s_hotend_peak);
+    return expect_alert("THERMAL RUNAWAY", fault, false) && check(cancel_heatup, "heatup not cancelled");
+}
+
+static bool scenario_runaway_bed()
+{
+    heatup(true, 60, 900);
+    const float fault = sim_seconds();
+    s_fault.bed_open = true;
+    run(1800);
+    return expect_alert("BED THERMAL RUNAWAY", fault, false) && check(cancel_heatup, "heatup not cancelled");
+}
+
+static bool scenario_mintemp()
+{
+    heatup(false, 215, 300);
+    const float fault = sim_seconds();
+    s_fault.sensor_open = true;
+    run(60);
+    return expect_alert("Err: MINTEMP", fault, true);
+}
+
+static bool scenario_maxtemp()
+{
+    s_fault.heater_stuck = true;
+    setTargetHotend(215, 0);
+    run(600);
+    return expect_alert("Err: MAXTEMP", 0, true);
+}
+
+static bool scenario_maxtemp_bed()
+{
+    s_fault.bed_stuck = true;
+    setTargetBed(60);
+    run(3600);
+    return expect_alert("Err: MAXTEMP BED", 0, true);
+}
+
+static const struct
+{
+    const char *name;
+    bool (*run)();
+} s_scenarios[] = {
+    { "autotune", [] { return scenario_autotune(false); } },
+    { "autotune_bed", [] { return scenario_autotune(true); } },
+    { "heatup", [] { return scenario_heatup(false); } },
+    { "heatup_bed", [] { return scenario_heatup(true); } },
+    { "extrusion", scenario_extrusion },
+    { "preheat_runaway", scenario_preheat_runaway },
+    { "runaway", scenario_runaway },
+    { "runaway_bed", scenario_runaway_bed },
+    { "mintemp", scenario_mintemp },
+    { "maxtemp", scenario_maxtemp },
+    { "maxtemp_bed", scenario_maxtemp_bed },
+};
+
+int main(int argc, const char *argv[])
+{
+    const char *scenario = NULL;
+    for (int i = 1; i < argc; ++ i) {
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            s_trace = fopen(argv[++ i], "w");
+            if (! s_trace) {
+                fprintf(stderr, "Cannot open %s\n", argv[i]);
+                return 1;
+            }
+            fputs("time,hotend,hotend_sensor,hotend_measured,hotend_target,bed,bed_measured,bed_target\n", s_trace);
+        } else
+            scenario = argv[i];
+    }
+    bool (*run_scenario)() = NULL;
+    for (const auto &s : s_scenarios)
+        if (scenario && strcmp(scenario, s.name) == 0)
+            run_scenario = s.run;
+    if (! run_scenario) {
+        fprintf(stderr, "Usage: thermal_sim [--trace trace.csv] scenario\nScenarios:");
+        for (const auto &s : s_scenarios)
+            fprintf(stderr, " %s", s.name);
+        fputc('\n', stderr);
+        return 1;
+    }
+
+    sim_avr_reset();
+    sim_marlin_reset();
+    tp_init();
+    // Let the first measurements in.
+    run(2);
+
+    const host_clock::time_point start = host_clock::now();
+    const bool passed = run_scenario() && check(! s_killed, "killed");
+    const double wall = std::chrono::duration<double>(host_clock::now() - start).count();
+    printf("%s: %s, %.0f s simulated in %.2f s (%.0fx real time)\n", scenario, passed ? "passed" : "FAILED",
+        sim_seconds(), wall, sim_seconds() / wall);
+    if (s_trace)
+        fclose(s_trace);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+/**
+ * @file
+ * @brief Host replacement of util/delay.h for the simulation targets.
+ *
+ * Busy waits take no simulated time.
+ */
+
+#ifndef TESTS_SIM_UTIL_DELAY_H_
+#define TESTS_SIM_UTIL_DELAY_H_
+
+#define _delay_us(us) do { } while (0)
+#define _delay_ms(ms) do { } while (0)
+
+#endif /* TESTS_SIM_UTIL_DELAY_H_ */